@@ -76,6 +76,12 @@ public:
   /// This `enqueue` variant allows to define forwarding chains.
   virtual void enqueue(mailbox_element_ptr what, execution_unit* host) = 0;
 
+  /// Enqueues all elements in `xs` to the actor. The default implementation
+  /// calls `enqueue` for each element, whereas actors with a mailbox may
+  /// publish all elements at once.
+  virtual void enqueue_batch(std::vector<mailbox_element_ptr> xs,
+                             execution_unit* host);
+
   /// Attaches `ptr` to this actor. The actor will call `ptr->detach(...)` on
   /// exit, or immediately if it already finished execution.
   virtual void attach(attachable_ptr ptr) = 0;
@@ -119,6 +125,12 @@ public:
   ///          mailbox is empty or the actor does not have a mailbox.
   virtual mailbox_element* peek_at_next_mailbox_element();
 
+  /// Returns the approximate number of messages in the mailbox of this actor.
+  /// Actors only keep track of their mailbox size when explicitly requested
+  /// (see `scheduled_actor::track_mailbox_size`). The default implementation
+  /// always returns 0.
+  virtual size_t mailbox_size_hint() const noexcept;
+
   template <class... Ts>
   void eq_impl(message_id mid, strong_actor_ptr sender, execution_unit* ctx,
                Ts&&... xs) {
@@ -26,6 +26,7 @@
 #include "caf/detail/unique_function.hpp"
 #include "caf/fwd.hpp"
 #include "caf/input_range.hpp"
+#include "caf/mailbox_overflow_policy.hpp"
 
 namespace caf {
 
@@ -49,6 +50,12 @@ public:
   input_range<const group>* groups;
   detail::unique_function<behavior(local_actor*)> init_fun;
 
+  /// Bounds the mailbox of scheduled actors unless 0.
+  size_t mailbox_capacity;
+
+  /// Selects how scheduled actors handle messages beyond `mailbox_capacity`.
+  mailbox_overflow_policy mailbox_overflow;
+
   // -- properties -------------------------------------------------------------
 
   actor_config& add_flag(int x) {
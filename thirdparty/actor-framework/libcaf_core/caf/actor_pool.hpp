@@ -18,17 +18,20 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "caf/actor.hpp"
+#include "caf/actor_clock.hpp"
 #include "caf/detail/core_export.hpp"
-#include "caf/detail/shared_spinlock.hpp"
 #include "caf/detail/split_join.hpp"
 #include "caf/execution_unit.hpp"
-#include "caf/locks.hpp"
 #include "caf/mailbox_element.hpp"
 #include "caf/monitorable_actor.hpp"
+#include "caf/timespan.hpp"
 
 namespace caf {
 
@@ -42,6 +45,10 @@ namespace caf {
 /// `{'SYS', 'DELETE'}` removes all workers, and `{'SYS', 'GET'}` returns a
 /// `vector<actor>` containing all workers.
 ///
+/// Elastic pools adjust the number of workers automatically. They spawn
+/// additional workers from their factory when messages queue up in the
+/// mailboxes of their workers and retire workers again after some idle time.
+///
 /// Note that the pool *always*  sends exit messages to all of its workers
 /// when forced to quit. The pool monitors all of its workers. Messages queued
 /// up in a worker's mailbox are lost, i.e., the pool itself does not buffer
@@ -52,15 +59,42 @@ namespace caf {
 /// Neither does it live in its own thread. Messages are dispatched immediately
 /// during the enqueue operation. Any user-defined policy thus has to dispatch
 /// messages with as little overhead as possible, because the dispatching
-/// runs in the context of the sender.
+/// runs in the context of the sender. Senders never block each other: the pool
+/// publishes an immutable snapshot of its workers whenever the set of workers
+/// changes and policies always operate on such a snapshot.
+///
+/// For load-aware policies, the pool calls `scheduled_actor::track_mailbox_size`
+/// on all of its workers. Policies may then read the approximate number of
+/// queued messages per worker via `abstract_actor::mailbox_size_hint`. Workers
+/// that are not event-based actors always report an empty mailbox.
 /// @experimental
 class CAF_CORE_EXPORT actor_pool : public monitorable_actor {
 public:
-  using uplock = upgrade_lock<detail::shared_spinlock>;
   using actor_vec = std::vector<actor>;
   using factory = std::function<actor()>;
-  using policy = std::function<void(actor_system&, uplock&, const actor_vec&,
+  using policy = std::function<void(actor_system&, const actor_vec&,
                                     mailbox_element_ptr&, execution_unit*)>;
+  using key_function = std::function<uint64_t(const message&)>;
+
+  /// Configures an elastic pool.
+  struct elastic_config {
+    /// Minimum number of workers. Must be at least 1.
+    size_t min_workers = 1;
+
+    /// Maximum number of workers.
+    size_t max_workers = 16;
+
+    /// Adds workers whenever the average number of queued messages per worker
+    /// exceeds this threshold.
+    size_t backlog_threshold = 8;
+
+    /// Retires one worker whenever the workers had no queued messages for
+    /// this amount of time.
+    timespan idle_timeout = std::chrono::seconds(10);
+
+    /// Configures how often the pool checks the mailboxes of its workers.
+    timespan interval = std::chrono::milliseconds(100);
+  };
 
   /// Returns a simple round robin dispatching policy.
   static policy round_robin();
@@ -71,6 +105,21 @@ public:
   /// Returns a random dispatching policy.
   static policy random();
 
+  /// Returns a policy that dispatches each message to the worker with the
+  /// smallest mailbox. Scans all workers for each message.
+  static policy join_shortest_queue();
+
+  /// Returns a policy that picks two workers at random and dispatches each
+  /// message to the worker with the smaller mailbox. Achieves nearly the same
+  /// load balancing as `join_shortest_queue` at constant cost per message.
+  static policy power_of_two_choices();
+
+  /// Returns a policy that dispatches all messages with the same key to the
+  /// same worker, e.g., for sharding stateful workers. Adding or removing a
+  /// worker only re-assigns the keys of that worker. The function object `f`
+  /// computes the key for a message.
+  static policy consistent_hashing(key_function f);
+
   /// Returns a split/join dispatching policy. The function object `sf`
   /// distributes a work item to all workers (split step) and the function
   /// object `jf` joins individual results into a single one with `init`
@@ -99,6 +148,12 @@ public:
   static actor
   make(execution_unit* eu, size_t num_workers, const factory& fac, policy pol);
 
+  /// Returns an elastic actor pool that starts with `cfg.min_workers` workers
+  /// and then spawns or retires workers created by the factory function `fac`
+  /// depending on the backlog of its workers.
+  static actor
+  make(execution_unit* eu, const elastic_config& cfg, factory fac, policy pol);
+
   void enqueue(mailbox_element_ptr what, execution_unit* eu) override;
 
   actor_pool(actor_config& cfg);
@@ -113,17 +168,55 @@ protected:
   void on_cleanup(const error& reason) override;
 
 private:
-  bool filter(upgrade_lock<detail::shared_spinlock>&,
-              const strong_actor_ptr& sender, message_id mid, message& msg,
-              execution_unit* eu);
+  using actor_vec_ptr = std::shared_ptr<const actor_vec>;
+
+  bool filter(const actor_vec& workers, const strong_actor_ptr& sender,
+              message_id mid, message& msg, execution_unit* eu);
+
+  // Returns the current set of workers.
+  actor_vec_ptr workers() const {
+    return std::atomic_load(&workers_);
+  }
+
+  // Replaces the set of workers with the result of `f(workers)` and returns
+  // the new number of workers. Requires holding `workers_mtx_`.
+  template <class F>
+  size_t update_workers(F f) {
+    auto xs = std::make_shared<actor_vec>(*workers());
+    f(*xs);
+    auto result = xs->size();
+    std::atomic_store(&workers_, actor_vec_ptr{std::move(xs)});
+    return result;
+  }
+
+  static void enable_mailbox_size_tracking(const actor& worker);
+
+  // Spawns or retires workers based on the current backlog.
+  void scale();
+
+  // Schedules the next `{'SYS', 'TICK'}` message for an elastic pool.
+  void schedule_tick();
 
   // call without workers_mtx_ held
   void quit(execution_unit* host);
 
-  detail::shared_spinlock workers_mtx_;
-  std::vector<actor> workers_;
+  // Serializes all modifications to the set of workers.
+  std::mutex workers_mtx_;
+
+  // Points to an immutable snapshot of all workers.
+  actor_vec_ptr workers_;
+
   policy policy_;
   exit_reason planned_reason_;
+
+  // Creates new workers for an elastic pool. Empty for fixed-size pools.
+  factory factory_;
+
+  // Configures scaling for an elastic pool.
+  elastic_config elastic_;
+
+  // Stores when an elastic pool had queued messages for the last time.
+  actor_clock::time_point last_busy_;
 };
 
 } // namespace caf
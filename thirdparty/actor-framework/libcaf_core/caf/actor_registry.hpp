@@ -69,6 +69,9 @@ public:
   /// @returns the increased count.
   size_t inc_running();
 
+  /// Increases running-actors-count by `n`.
+  void inc_running(size_t n);
+
   /// Decreases running-actors-count by one.
   /// @returns the decreased count.
   size_t dec_running();
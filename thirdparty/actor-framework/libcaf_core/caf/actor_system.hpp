@@ -27,6 +27,7 @@
 #include <mutex>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 #include "caf/abstract_actor.hpp"
 #include "caf/actor_cast.hpp"
@@ -35,6 +36,7 @@
 #include "caf/actor_profiler.hpp"
 #include "caf/actor_registry.hpp"
 #include "caf/actor_traits.hpp"
+#include "caf/detail/batched_execution_unit.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/init_fun_factory.hpp"
 #include "caf/detail/spawn_fwd.hpp"
@@ -179,16 +181,16 @@ public:
   struct base_metrics_t {
     /// Counts the number of messages that where rejected because the target
     /// mailbox was closed or did not exist.
-    telemetry::int_counter* rejected_messages;
+    telemetry::sharded_int_counter* rejected_messages;
 
     /// Counts the total number of processed messages.
-    telemetry::int_counter* processed_messages;
+    telemetry::sharded_int_counter* processed_messages;
 
     /// Tracks the current number of running actors in the system.
     telemetry::int_gauge* running_actors;
 
     /// Counts the total number of messages that wait in a mailbox.
-    telemetry::int_gauge* queued_messages;
+    telemetry::sharded_int_gauge* queued_messages;
   };
 
   /// Metrics that some actors may collect in addition to the base metrics. All
@@ -202,6 +204,14 @@ public:
     /// processes it.
     telemetry::dbl_histogram_family* mailbox_time = nullptr;
 
+    /// Replaces `processing_time` if `caf.metrics-filters.actors.hdr-histograms`
+    /// is `true`.
+    telemetry::hdr_histogram_family* hdr_processing_time = nullptr;
+
+    /// Replaces `mailbox_time` if `caf.metrics-filters.actors.hdr-histograms`
+    /// is `true`.
+    telemetry::hdr_histogram_family* hdr_mailbox_time = nullptr;
+
     /// Counts how many messages are currently waiting in the mailbox.
     telemetry::int_gauge_family* mailbox_size = nullptr;
 
@@ -344,6 +354,9 @@ public:
   /// Returns a new actor ID.
   actor_id next_actor_id();
 
+  /// Reserves `n` consecutive actor IDs and returns the first one.
+  actor_id next_actor_ids(size_t n);
+
   /// Returns the last given actor ID.
   actor_id latest_actor_id() const;
 
@@ -421,6 +434,42 @@ public:
                              std::forward<Ts>(xs)...);
   }
 
+  /// Returns `n` new actors of type `C`, each constructed from copies of
+  /// `xs...`. Unlike calling `spawn` in a loop, this function reserves all
+  /// actor IDs at once, updates the running-actors count only once, and passes
+  /// all actors to the scheduler in a single batch.
+  /// @param n Number of actors to spawn.
+  /// @param xs Constructor arguments for `C`.
+  template <class C, spawn_options Os = no_spawn_options, class... Ts>
+  std::vector<infer_handle_from_class_t<C>> spawn_n(size_t n, Ts&&... xs) {
+    check_invariants<C>();
+    return spawn_n_impl<C, Os>(n, [&](actor_config& cfg, actor_id aid) {
+      return make_actor<C>(aid, node(), this, cfg,
+                           detail::spawn_fwd<Ts&>(xs)...);
+    });
+  }
+
+  /// Returns `n` new functor-based actors, each running a copy of `fun`
+  /// invoked with copies of `xs...`.
+  /// @param n Number of actors to spawn.
+  /// @param fun Function object for the behavior of the actors.
+  /// @param xs Arguments for `fun`.
+  /// @see spawn_n
+  template <spawn_options Os = no_spawn_options, class F, class... Ts>
+  std::vector<infer_handle_from_fun_t<F>>
+  spawn_n(size_t n, F fun, Ts&&... xs) {
+    using impl = infer_impl_from_fun_t<F>;
+    using handle = infer_handle_from_fun_t<F>;
+    check_invariants<impl>();
+    static_assert(detail::spawnable<F, impl, Ts...>(),
+                  "cannot spawn function-based actor with given arguments");
+    detail::init_fun_factory<impl, F> fac;
+    return spawn_n_impl<impl, Os>(n, [&](actor_config& cfg, actor_id aid) {
+      cfg.init_fun = fac(fun, xs...);
+      return make_actor<impl, handle>(aid, node(), this, cfg);
+    });
+  }
+
   /// Returns a new actor with run-time type `name`, constructed
   /// with the arguments stored in `args`.
   /// @experimental
@@ -575,6 +624,14 @@ public:
     return metrics_actors_excludes_;
   }
 
+  size_t metrics_actors_sample_interval() const noexcept {
+    return metrics_actors_sample_interval_;
+  }
+
+  bool metrics_actors_tsc_clock() const noexcept {
+    return metrics_actors_tsc_clock_;
+  }
+
   template <class C, spawn_options Os, class... Ts>
   infer_handle_from_class_t<C> spawn_impl(actor_config& cfg, Ts&&... xs) {
     static_assert(is_unbound(Os),
@@ -597,6 +654,48 @@ public:
     return res;
   }
 
+  template <class C, spawn_options Os, class Factory>
+  auto spawn_n_impl(size_t n, Factory make) {
+    static_assert(is_unbound(Os),
+                  "top-level spawns cannot have monitor or link flag");
+    using handle_type = decltype(make(std::declval<actor_config&>(), 0));
+    std::vector<handle_type> result;
+    if (n == 0)
+      return result;
+    result.reserve(n);
+    CAF_SET_LOGGER_SYS(this);
+    auto first_id = next_actor_ids(n);
+    for (size_t i = 0; i < n; ++i) {
+      actor_config cfg{dummy_execution_unit()};
+      if (has_detach_flag(Os) || std::is_base_of<blocking_actor, C>::value)
+        cfg.flags |= abstract_actor::is_detached_flag;
+      if (has_hide_flag(Os))
+        cfg.flags |= abstract_actor::is_hidden_flag;
+      auto hdl = make(cfg, static_cast<actor_id>(first_id + i));
+#ifdef CAF_ENABLE_ACTOR_PROFILER
+      profiler_add_actor(*static_cast<C*>(actor_cast<abstract_actor*>(hdl)),
+                         cfg.parent);
+#endif
+      result.emplace_back(std::move(hdl));
+    }
+    // Register all actors before launching any of them, since an actor may
+    // unregister itself as soon as it runs.
+    if (!has_hide_flag(Os)) {
+      for (auto& hdl : result)
+        actor_cast<abstract_actor*>(hdl)->setf(
+          abstract_actor::is_registered_flag);
+      registry().inc_running(n);
+    }
+    detail::batched_execution_unit host{this};
+    host.reserve(n);
+    for (auto& hdl : result) {
+      auto ptr = static_cast<C*>(actor_cast<abstract_actor*>(hdl));
+      ptr->launch(&host, has_lazy_init_flag(Os), true);
+    }
+    host.flush();
+    return result;
+  }
+
   void profiler_add_actor(const local_actor& self, const local_actor* parent) {
     if (profiler_)
       profiler_->add_actor(self, parent);
@@ -648,6 +747,10 @@ public:
     return tracing_context_;
   }
 
+  caf::tracer* tracer() const noexcept {
+    return tracer_.get();
+  }
+
   /// @endcond
 
 private:
@@ -746,8 +849,21 @@ private:
   /// for faster lookups at runtime.
   std::vector<std::string> metrics_actors_excludes_;
 
+  /// Caches the configuration parameter
+  /// `caf.metrics-filters.actors.sample-interval` for faster lookups at
+  /// runtime.
+  size_t metrics_actors_sample_interval_ = 1;
+
+  /// Caches the configuration parameter `caf.metrics-filters.actors.tsc-clock`
+  /// for faster lookups at runtime.
+  bool metrics_actors_tsc_clock_ = false;
+
   /// Caches families for optional actor metrics.
   actor_metric_families_t actor_metric_families_;
+
+  /// Records spans for sampled messages if `caf.tracing.sample-rate` is
+  /// greater than 0.
+  std::unique_ptr<caf::tracer> tracer_;
 };
 
 } // namespace caf
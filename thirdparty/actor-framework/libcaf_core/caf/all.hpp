@@ -70,6 +70,7 @@
 #include "caf/init_global_meta_objects.hpp"
 #include "caf/local_actor.hpp"
 #include "caf/logger.hpp"
+#include "caf/mailbox_overflow_policy.hpp"
 #include "caf/make_config_option.hpp"
 #include "caf/may_have_timeout.hpp"
 #include "caf/memory_managed.hpp"
@@ -101,6 +102,8 @@
 #include "caf/term.hpp"
 #include "caf/thread_hook.hpp"
 #include "caf/timeout_definition.hpp"
+#include "caf/trace_context.hpp"
+#include "caf/tracer.hpp"
 #include "caf/tracing_data.hpp"
 #include "caf/tracing_data_factory.hpp"
 #include "caf/type_id.hpp"
@@ -108,6 +108,14 @@ constexpr auto relaxed_sleep_duration = timespan{10'000'000};
 
 } // namespace caf::defaults::work_stealing
 
+namespace caf::defaults::groups {
+
+/// Number of subscribers at which local groups start delivering messages via
+/// the scheduler instead of enqueueing to all subscribers in the caller.
+constexpr auto fan_out_threshold = size_t{4096};
+
+} // namespace caf::defaults::groups
+
 namespace caf::defaults::logger::file {
 
 constexpr auto format = string_view{"%r %c %p %a %t %C %M %F:%L %m%n"};
@@ -122,6 +130,13 @@ constexpr auto format = string_view{"[%c:%p] %d %m"};
 
 } // namespace caf::defaults::logger::console
 
+namespace caf::defaults::tracing {
+
+constexpr auto output = string_view{"caf-traces.json"};
+constexpr auto service_name = string_view{"caf"};
+
+} // namespace caf::defaults::tracing
+
 namespace caf::defaults::middleman {
 
 constexpr auto app_identifier = string_view{"generic-caf-app"};
@@ -0,0 +1,51 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/execution_unit.hpp"
+
+namespace caf::detail {
+
+/// Collects all jobs passed to `exec_later` and hands them over to the
+/// scheduler in a single batch when calling `flush`.
+class CAF_CORE_EXPORT batched_execution_unit : public execution_unit {
+public:
+  using super = execution_unit;
+
+  using super::super;
+
+  ~batched_execution_unit() override;
+
+  /// Stores `ptr` until the next call to `flush`.
+  void exec_later(resumable* ptr) override;
+
+  /// Reserves space for `n` jobs.
+  void reserve(size_t n);
+
+  /// Delegates all collected jobs to the scheduler of `system()`.
+  void flush();
+
+private:
+  std::vector<resumable*> jobs_;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,62 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/span.hpp"
+#include "caf/type_id_list.hpp"
+
+namespace caf::detail {
+
+/// Maps the input types of a message to the index of the first case in a
+/// behavior that accepts them. Since handlers match on type ID lists only,
+/// cases with identical input types shadow each other and the table only
+/// stores the first one to preserve first-match semantics.
+class CAF_CORE_EXPORT behavior_dispatch_table {
+public:
+  // -- member types -----------------------------------------------------------
+
+  struct entry {
+    type_id_list types;
+    size_t index;
+  };
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  /// Builds the table from the input types of all cases, in order.
+  explicit behavior_dispatch_table(span<const type_id_list> cases);
+
+  // -- lookups ----------------------------------------------------------------
+
+  /// Returns the index of the first case that accepts `types` or the number of
+  /// cases if no case matches.
+  size_t find(type_id_list types) const noexcept;
+
+private:
+  /// Stores one entry per distinct input type list, sorted by address.
+  std::vector<entry> entries_;
+
+  /// Stores the number of cases in the behavior.
+  size_t num_cases_;
+};
+
+} // namespace caf::detail
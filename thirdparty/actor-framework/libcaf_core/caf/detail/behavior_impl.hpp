@@ -18,12 +18,14 @@
 
 #pragma once
 
+#include <array>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
 #include "caf/const_typed_message_view.hpp"
 #include "caf/detail/apply_args.hpp"
+#include "caf/detail/behavior_dispatch_table.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/int_list.hpp"
 #include "caf/detail/invoke_result_visitor.hpp"
@@ -114,6 +116,10 @@ public:
 
   using tuple_type = std::tuple<Ts...>;
 
+  /// Behaviors with more cases than this threshold select the handler via a
+  /// sorted lookup table instead of trying each case in order.
+  static constexpr size_t dispatch_table_threshold = 8;
+
   default_behavior_impl(tuple_type&& tup, TimeoutDefinition timeout_definition)
     : super(timeout_definition.timeout),
       cases_(std::move(tup)),
@@ -122,7 +128,11 @@ public:
   }
 
   virtual bool invoke(detail::invoke_result_visitor& f, message& xs) override {
-    return invoke_impl(f, xs, std::make_index_sequence<sizeof...(Ts)>{});
+    using indexes = std::make_index_sequence<sizeof...(Ts)>;
+    if constexpr (sizeof...(Ts) > dispatch_table_threshold)
+      return invoke_indexed(f, xs, indexes{});
+    else
+      return invoke_impl(f, xs, indexes{});
   }
 
   template <size_t... Is>
@@ -130,18 +140,8 @@ public:
                    std::index_sequence<Is...>) {
     auto dispatch = [&](auto& fun) {
       using fun_type = std::decay_t<decltype(fun)>;
-      using trait = get_callable_trait_t<fun_type>;
-      auto arg_types = to_type_id_list<typename trait::decayed_arg_types>();
-      if (arg_types == msg.types()) {
-        typename trait::message_view_type xs{msg};
-        using fun_result = decltype(detail::apply_args(fun, xs));
-        if constexpr (std::is_same<void, fun_result>::value) {
-          detail::apply_args(fun, xs);
-          f(unit);
-        } else {
-          auto invoke_res = detail::apply_args(fun, xs);
-          f(invoke_res);
-        }
+      if (input_types<fun_type>() == msg.types()) {
+        apply_case(fun, f, msg);
         return true;
       }
       return false;
@@ -149,11 +149,55 @@ public:
     return (dispatch(std::get<Is>(cases_)) || ...);
   }
 
+  template <size_t... Is>
+  bool invoke_indexed(detail::invoke_result_visitor& f, message& msg,
+                      std::index_sequence<Is...>) {
+    // The input types of each case only depend on Ts, i.e., all instances
+    // share the same table and we build it only once.
+    using types_array = std::array<type_id_list, sizeof...(Ts)>;
+    static const behavior_dispatch_table tbl{types_array{input_types<Ts>()...}};
+    using impl_fun = void (*)(default_behavior_impl&, invoke_result_visitor&,
+                              message&);
+    static constexpr impl_fun impls[] = {&apply_case_at<Is>...};
+    auto index = tbl.find(msg.types());
+    if (index == sizeof...(Ts))
+      return false;
+    impls[index](*this, f, msg);
+    return true;
+  }
+
   void handle_timeout() override {
     timeout_definition_.handler();
   }
 
 private:
+  template <class Fun>
+  static type_id_list input_types() {
+    using trait = get_callable_trait_t<Fun>;
+    return to_type_id_list<typename trait::decayed_arg_types>();
+  }
+
+  template <class Fun>
+  static void apply_case(Fun& fun, detail::invoke_result_visitor& f,
+                         message& msg) {
+    using trait = get_callable_trait_t<Fun>;
+    typename trait::message_view_type xs{msg};
+    using fun_result = decltype(detail::apply_args(fun, xs));
+    if constexpr (std::is_same<void, fun_result>::value) {
+      detail::apply_args(fun, xs);
+      f(unit);
+    } else {
+      auto invoke_res = detail::apply_args(fun, xs);
+      f(invoke_res);
+    }
+  }
+
+  template <size_t I>
+  static void apply_case_at(default_behavior_impl& self,
+                            detail::invoke_result_visitor& f, message& msg) {
+    apply_case(std::get<I>(self.cases_), f, msg);
+  }
+
   tuple_type cases_;
 
   TimeoutDefinition timeout_definition_;
@@ -28,6 +28,7 @@
 #include "caf/mailbox_element.hpp"
 #include "caf/message_id.hpp"
 #include "caf/no_stages.hpp"
+#include "caf/tracer.hpp"
 
 namespace caf::detail {
 
@@ -39,6 +40,8 @@ void profiled_send(Self* self, SelfHandle&& src, const Handle& dst,
     auto element = make_mailbox_element(std::forward<SelfHandle>(src), msg_id,
                                         std::move(stages),
                                         std::forward<Ts>(xs)...);
+    tracer::propagate(self->home_system().tracer(),
+                      self->current_mailbox_element(), *element);
     CAF_BEFORE_SENDING(self, *element);
     dst->enqueue(std::move(element), context);
   } else {
@@ -57,6 +60,8 @@ void profiled_send(Self* self, SelfHandle&& src, const Handle& dst,
     } else {
       auto element = make_mailbox_element(std::forward<SelfHandle>(src), msg_id,
                                           no_stages, std::forward<Ts>(xs)...);
+      tracer::propagate(self->home_system().tracer(),
+                        self->current_mailbox_element(), *element);
       CAF_BEFORE_SENDING_SCHEDULED(self, timeout, *element);
       clock.schedule_message(timeout, actor_cast<strong_actor_ptr>(dst),
                              std::move(element));
@@ -0,0 +1,86 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "caf/config.hpp"
+#include "caf/detail/core_export.hpp"
+
+namespace caf::detail {
+
+/// An integer that spreads concurrent updates over multiple cache lines. Each
+/// thread only writes to one cell, while reading the value adds up all cells.
+/// This trades slower reads for uncontended writes.
+class CAF_CORE_EXPORT sharded_int {
+public:
+  // -- constructors, destructors, and assignment operators --------------------
+
+  sharded_int();
+
+  explicit sharded_int(int64_t initial_value);
+
+  sharded_int(const sharded_int&) = delete;
+
+  sharded_int& operator=(const sharded_int&) = delete;
+
+  ~sharded_int();
+
+  // -- modifiers --------------------------------------------------------------
+
+  /// Adds `x` to the cell of the calling thread.
+  void add(int64_t x) noexcept {
+    cells_[shard_index() & mask_].value.fetch_add(x, std::memory_order_relaxed);
+  }
+
+  // -- observers --------------------------------------------------------------
+
+  /// Returns the sum of all cells.
+  int64_t sum() const noexcept;
+
+  /// Returns the number of cells.
+  size_t num_cells() const noexcept {
+    return mask_ + 1;
+  }
+
+  // -- static utility functions -----------------------------------------------
+
+  /// Returns a small integer that identifies the calling thread. Threads get
+  /// their index assigned round-robin on first use.
+  static size_t shard_index() noexcept {
+    thread_local size_t result = next_shard_index();
+    return result;
+  }
+
+private:
+  struct alignas(CAF_CACHE_LINE_SIZE) cell {
+    std::atomic<int64_t> value{0};
+  };
+
+  static size_t next_shard_index() noexcept;
+
+  std::unique_ptr<cell[]> cells_;
+
+  size_t mask_;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,168 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "caf/optional.hpp"
+#include "caf/string_view.hpp"
+
+namespace caf::detail {
+
+/// Maps topic filters to values. Topics consist of levels separated by `/`. In
+/// a filter, the level `+` matches exactly one level and a trailing `#` matches
+/// any number of levels, including none. For example, the filter `sensors/+/t`
+/// matches the topic `sensors/1/t` and the filter `sensors/#` matches the
+/// topics `sensors`, `sensors/1` and `sensors/1/t`.
+template <class T>
+class topic_trie {
+public:
+  // -- constants --------------------------------------------------------------
+
+  static constexpr char separator = '/';
+
+  static constexpr string_view single_level_wildcard = "+";
+
+  static constexpr string_view multi_level_wildcard = "#";
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns whether `filter` is a valid topic filter, i.e., whether all
+  /// wildcards occupy an entire level and `#` only appears on the last level.
+  static bool valid_filter(string_view filter) noexcept {
+    if (filter.empty())
+      return false;
+    bool result = true;
+    for_each_level(filter, [&](string_view level, bool last) {
+      if (has_wildcards(level) && level != single_level_wildcard
+          && (level != multi_level_wildcard || !last))
+        result = false;
+    });
+    return result;
+  }
+
+  /// Returns whether `filter` contains wildcards.
+  static bool has_wildcards(string_view filter) noexcept {
+    return filter.find_first_of("+#") != string_view::npos;
+  }
+
+  /// Returns the number of stored filters.
+  size_t size() const noexcept {
+    return size_;
+  }
+
+  /// Returns whether this trie contains no filters.
+  bool empty() const noexcept {
+    return size_ == 0;
+  }
+
+  // -- modifiers --------------------------------------------------------------
+
+  /// Stores `value` for `filter` unless the trie already contains `filter`.
+  /// @returns `true` if the trie stored `value`, `false` otherwise.
+  /// @pre `valid_filter(filter)`
+  bool insert(string_view filter, T value) {
+    auto* pos = &root_;
+    for_each_level(filter, [&](string_view level, bool) {
+      auto& child = pos->children[std::string{level.begin(), level.end()}];
+      if (!child)
+        child.reset(new node);
+      pos = child.get();
+    });
+    if (pos->value)
+      return false;
+    pos->value = std::move(value);
+    ++size_;
+    return true;
+  }
+
+  /// Removes all filters.
+  void clear() {
+    root_.children.clear();
+    root_.value = none;
+    size_ = 0;
+  }
+
+  // -- lookups ----------------------------------------------------------------
+
+  /// Calls `f` with the value of each filter that matches `topic`.
+  template <class F>
+  void for_each_match(string_view topic, F&& f) const {
+    for_each_match_impl(root_, topic, f);
+  }
+
+private:
+  struct node {
+    std::map<std::string, std::unique_ptr<node>> children;
+    optional<T> value;
+  };
+
+  // Calls `f(level, last)` for each level in `str`.
+  template <class F>
+  static void for_each_level(string_view str, F&& f) {
+    for (;;) {
+      auto pos = str.find(separator);
+      if (pos == string_view::npos) {
+        f(str, true);
+        return;
+      }
+      f(str.substr(0, pos), false);
+      str.remove_prefix(pos + 1);
+    }
+  }
+
+  const node* child(const node& parent, string_view level) const {
+    auto i = parent.children.find(std::string{level.begin(), level.end()});
+    return i != parent.children.end() ? i->second.get() : nullptr;
+  }
+
+  // Matches the remaining levels in `topic` against the filters below `pos`.
+  // An empty optional for `topic` denotes that the topic has no levels left.
+  template <class F>
+  void for_each_match_impl(const node& pos, optional<string_view> topic,
+                           F& f) const {
+    if (auto hash = child(pos, multi_level_wildcard); hash && hash->value)
+      f(*hash->value);
+    if (!topic) {
+      if (pos.value)
+        f(*pos.value);
+      return;
+    }
+    string_view level = *topic;
+    optional<string_view> rest;
+    if (auto sep = level.find(separator); sep != string_view::npos) {
+      rest = level.substr(sep + 1);
+      level = level.substr(0, sep);
+    }
+    if (auto next = child(pos, level))
+      for_each_match_impl(*next, rest, f);
+    if (level != single_level_wildcard)
+      if (auto next = child(pos, single_level_wildcard))
+        for_each_match_impl(*next, rest, f);
+  }
+
+  node root_;
+
+  size_t size_ = 0;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,93 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "caf/config.hpp"
+#include "caf/detail/core_export.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)               \
+  || defined(_M_IX86)
+#  define CAF_HAS_TSC_CLOCK
+#  ifdef CAF_MSVC
+#    include <intrin.h>
+#  else
+#    include <x86intrin.h>
+#  endif
+#endif
+
+namespace caf::detail {
+
+/// A clock that reads the time stamp counter of the CPU instead of querying the
+/// operating system. Time points are compatible with `std::chrono::steady_clock`
+/// (calibrated once per process), which allows mixing both clocks when
+/// computing intervals. On platforms without time stamp counter, this clock
+/// falls back to `std::chrono::steady_clock`.
+/// @note The time stamp counter is only a reliable time source on CPUs with an
+///       invariant TSC, i.e., with a constant rate that is synchronized
+///       across cores. All x86 CPUs of the last decade qualify.
+class CAF_CORE_EXPORT tsc_clock {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using base_clock = std::chrono::steady_clock;
+
+  using duration = base_clock::duration;
+
+  using rep = duration::rep;
+
+  using period = duration::period;
+
+  using time_point = base_clock::time_point;
+
+  // -- constants --------------------------------------------------------------
+
+  static constexpr bool is_steady = true;
+
+  // -- static member functions ------------------------------------------------
+
+  /// Returns the current time.
+  static time_point now() noexcept {
+#ifdef CAF_HAS_TSC_CLOCK
+    const auto& cal = calibration();
+    auto ticks = static_cast<double>(__rdtsc() - cal.tsc_base);
+    return cal.base + duration{static_cast<rep>(ticks * cal.rep_per_tick)};
+#else
+    return base_clock::now();
+#endif
+  }
+
+private:
+  struct calibration_data {
+    /// Time stamp counter at `base`.
+    uint64_t tsc_base;
+
+    /// Point in time where the calibration ended.
+    time_point base;
+
+    /// Converts ticks of the time stamp counter to duration counts.
+    double rep_per_tick;
+  };
+
+  static const calibration_data& calibration() noexcept;
+};
+
+} // namespace caf::detail
@@ -55,13 +55,13 @@ struct to_type_id_list_helper;
 
 template <class... Ts>
 struct to_type_id_list_helper<type_list<Ts...>> {
-  static constexpr type_id_list get() {
+  static type_id_list get() {
     return make_type_id_list<typename strip_param<Ts>::type...>();
   }
 };
 
 template <class List>
-constexpr type_id_list to_type_id_list() {
+type_id_list to_type_id_list() {
   return to_type_id_list_helper<List>::get();
 }
 
@@ -141,6 +141,7 @@ class serializer;
 class skip_t;
 class stream_manager;
 class string_view;
+class tracer;
 class tracing_data;
 class tracing_data_factory;
 class type_id_list;
@@ -172,6 +173,7 @@ struct open_stream_msg;
 struct prohibit_top_level_spawn_marker;
 struct stream_slots;
 struct timeout_msg;
+struct trace_context;
 struct unit_t;
 struct upstream_msg;
 struct upstream_msg_ack_batch;
@@ -254,6 +256,9 @@ class label_view;
 class metric;
 class metric_family;
 class metric_registry;
+class sharded_int_counter;
+class sharded_int_gauge;
+class hdr_histogram;
 class timer;
 
 enum class metric_type : uint8_t;
@@ -281,6 +286,9 @@ using dbl_gauge_family = metric_family_impl<dbl_gauge>;
 using int_counter_family = metric_family_impl<int_counter>;
 using int_histogram_family = metric_family_impl<int_histogram>;
 using int_gauge_family = metric_family_impl<int_gauge>;
+using sharded_int_counter_family = metric_family_impl<sharded_int_counter>;
+using sharded_int_gauge_family = metric_family_impl<sharded_int_gauge>;
+using hdr_histogram_family = metric_family_impl<hdr_histogram>;
 
 } // namespace telemetry
 
@@ -108,6 +108,30 @@ public:
     return push_back(new value_type(std::forward<Ts>(xs)...));
   }
 
+  /// Appends all elements in `xs` to the inbox with a single CAS operation.
+  /// Releases all elements in `xs` on success and leaves `xs` unmodified if
+  /// the inbox has been closed.
+  /// @pre `!xs.empty()`
+  template <class Container>
+  inbox_result push_back_all(Container& xs) noexcept {
+    CAF_ASSERT(!xs.empty());
+    // The inbox is a LIFO stack, i.e., the last element in `xs` becomes the
+    // new head and each element points to its predecessor in `xs`.
+    auto i = xs.begin();
+    auto tail = i->get();
+    auto head = tail;
+    for (++i; i != xs.end(); ++i) {
+      auto ptr = i->get();
+      ptr->next = head;
+      head = ptr;
+    }
+    auto result = inbox_.push_front_chain(head, tail);
+    if (result != inbox_result::queue_closed)
+      for (auto& x : xs)
+        x.release();
+    return result;
+  }
+
   // -- backwards compatibility ------------------------------------------------
 
   /// @cond PRIVATE
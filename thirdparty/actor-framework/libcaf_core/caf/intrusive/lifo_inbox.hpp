@@ -86,6 +86,28 @@ public:
     return push_front(x.release());
   }
 
+  /// Tries to enqueue the pre-linked chain of elements from `head` to `tail`
+  /// with a single CAS operation, whereas `head` becomes the new top of the
+  /// stack. Overrides `tail->next`. Unlike `push_front`, this function leaves
+  /// the ownership of all elements to the caller if the queue has been closed.
+  /// @threadsafe
+  inbox_result push_front_chain(pointer head, pointer tail) noexcept {
+    CAF_ASSERT(head != nullptr);
+    CAF_ASSERT(tail != nullptr);
+    pointer e = stack_.load();
+    auto eof = stack_closed_tag();
+    auto blk = reader_blocked_tag();
+    while (e != eof) {
+      // A tag is never part of a non-empty list.
+      tail->next = e != blk ? e : nullptr;
+      if (stack_.compare_exchange_strong(e, head))
+        return e == blk ? inbox_result::unblocked_reader
+                        : inbox_result::success;
+      // Continue with new value of `e`.
+    }
+    return inbox_result::queue_closed;
+  }
+
   /// Tries to enqueue a new element to the mailbox.
   /// @threadsafe
   template <class... Ts>
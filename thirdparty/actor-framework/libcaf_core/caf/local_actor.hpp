@@ -35,6 +35,7 @@
 #include "caf/check_typed_input.hpp"
 #include "caf/delegated.hpp"
 #include "caf/detail/core_export.hpp"
+#include "caf/detail/tsc_clock.hpp"
 #include "caf/detail/type_traits.hpp"
 #include "caf/detail/typed_actor_util.hpp"
 #include "caf/detail/unique_function.hpp"
@@ -49,8 +50,10 @@
 #include "caf/response_type.hpp"
 #include "caf/resumable.hpp"
 #include "caf/spawn_options.hpp"
+#include "caf/telemetry/hdr_histogram.hpp"
 #include "caf/telemetry/histogram.hpp"
 #include "caf/timespan.hpp"
+#include "caf/timestamp.hpp"
 #include "caf/typed_actor.hpp"
 #include "caf/typed_response_promise.hpp"
 
@@ -75,6 +78,53 @@ public:
 
     /// Counts how many messages are currently waiting in the mailbox.
     telemetry::int_gauge* mailbox_size = nullptr;
+
+    /// Replaces `processing_time` when using HDR histograms.
+    telemetry::hdr_histogram* hdr_processing_time = nullptr;
+
+    /// Replaces `mailbox_time` when using HDR histograms.
+    telemetry::hdr_histogram* hdr_mailbox_time = nullptr;
+
+    /// Configures how many messages the actor processes per timing sample.
+    size_t sample_interval = 1;
+
+    /// Counts down to the next message that the actor samples.
+    size_t sample_countdown = 0;
+
+    /// Configures whether the actor reads timestamps from `detail::tsc_clock`
+    /// instead of `clock_type`.
+    bool use_tsc_clock = false;
+
+    /// Returns the current time, using the configured clock.
+    clock_type::time_point now() const noexcept {
+      return use_tsc_clock ? detail::tsc_clock::now() : clock_type::now();
+    }
+
+    /// Returns whether the actor records timings for the next message.
+    bool sample() noexcept {
+      if (sample_countdown == 0) {
+        sample_countdown = sample_interval - 1;
+        return true;
+      }
+      --sample_countdown;
+      return false;
+    }
+
+    /// Records the metrics for a message that waited `mbox_time` seconds in
+    /// the mailbox and that the actor started processing at `t0`.
+    void message_processed(clock_type::time_point t0, double mbox_time) {
+      using dbl_sec = std::chrono::duration<double>;
+      auto t1 = now();
+      auto processing_time_sec = dbl_sec{t1 - t0}.count();
+      if (hdr_processing_time != nullptr) {
+        hdr_processing_time->observe(processing_time_sec);
+        hdr_mailbox_time->observe(mbox_time);
+      } else {
+        processing_time->observe(processing_time_sec);
+        mailbox_time->observe(mbox_time);
+      }
+      mailbox_size->dec();
+    }
   };
 
   /// Optional metrics for inbound stream traffic collected by individual actors
@@ -404,10 +454,14 @@ public:
   }
 
   bool has_metrics_enabled() const noexcept {
-    // Either all fields are null or none is.
-    return metrics_.processing_time != nullptr;
+    // Actors with metrics always have a mailbox size gauge.
+    return metrics_.mailbox_size != nullptr;
   }
 
+  /// Records the span for processing `x` since `start` if the actor system
+  /// has a tracer.
+  void record_span(const mailbox_element& x, timestamp start);
+
   template <class ActorHandle>
   ActorHandle eval_opts(spawn_options opts, ActorHandle res) {
     if (has_monitor_flag(opts))
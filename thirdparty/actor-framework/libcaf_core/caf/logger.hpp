@@ -18,14 +18,20 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <thread>
 #include <type_traits>
 #include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
 #include "caf/abstract_actor.hpp"
 #include "caf/config.hpp"
@@ -34,7 +40,6 @@
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/log_level.hpp"
 #include "caf/detail/pretty_type_name.hpp"
-#include "caf/detail/ringbuffer.hpp"
 #include "caf/detail/scope_guard.hpp"
 #include "caf/detail/shared_spinlock.hpp"
 #include "caf/fwd.hpp"
@@ -72,8 +77,12 @@ public:
 
   // -- constants --------------------------------------------------------------
 
-  /// Configures the size of the circular event queue.
-  static constexpr size_t queue_size = 128;
+  /// Configures the size of the circular event buffer for each thread.
+  static constexpr size_t queue_size = 256;
+
+  /// Configures how long the logger thread sleeps while all event buffers are
+  /// empty.
+  static constexpr auto poll_interval = std::chrono::milliseconds(5);
 
   // -- member types -----------------------------------------------------------
 
@@ -213,7 +222,8 @@ public:
 
   // -- logging ----------------------------------------------------------------
 
-  /// Writes an entry to the event-queue of the logger.
+  /// Writes an entry to the event buffer of the calling thread. Blocks the
+  /// caller while the buffer is full.
   /// @thread-safe
   void log(event&& x);
 
@@ -317,6 +327,17 @@ private:
 
   // -- event handling ---------------------------------------------------------
 
+  struct thread_buffer;
+
+  using thread_buffer_ptr = std::shared_ptr<thread_buffer>;
+
+  /// Returns the event buffer of the calling thread, creating it on first use.
+  thread_buffer& local_buffer();
+
+  /// Moves all buffered events to `out` and returns whether `out` is no
+  /// longer empty.
+  bool drain(std::vector<event>& out);
+
   void handle_event(const event& x);
 
   void handle_file_event(const event& x);
@@ -368,8 +389,21 @@ private:
   // Stream for file output.
   std::fstream file_;
 
-  // Filled with log events by other threads.
-  detail::ringbuffer<event, queue_size> queue_;
+  // Identifies this logger in the thread-local buffer caches.
+  size_t id_;
+
+  // Signals whether the logger thread accepts events.
+  std::atomic<bool> running_;
+
+  // Guards buffers_.
+  std::mutex buffers_mtx_;
+
+  // Wakes up the logger thread on shutdown.
+  std::condition_variable buffers_cv_;
+
+  // Stores one single-producer, single-consumer buffer per thread that logs
+  // events. Producers never acquire a lock unless adding a new buffer.
+  std::vector<thread_buffer_ptr> buffers_;
 
   // Stores the assembled name of the log file.
   std::string file_name_;
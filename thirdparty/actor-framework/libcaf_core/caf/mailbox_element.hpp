@@ -29,6 +29,7 @@
 #include "caf/message_id.hpp"
 #include "caf/meta/omittable_if_empty.hpp"
 #include "caf/meta/type_name.hpp"
+#include "caf/trace_context.hpp"
 #include "caf/tracing_data.hpp"
 
 namespace caf {
@@ -48,6 +49,10 @@ public:
   /// if this is empty then the original sender receives the response.
   forwarding_stack stages;
 
+  /// Identifies the trace and span of this message. Stays invalid unless the
+  /// message belongs to a sampled trace.
+  trace_context trace;
+
 #ifdef CAF_ENABLE_ACTOR_PROFILER
   /// Optional tracing information. This field is unused by default, but an
   /// @ref actor_profiler can make use of it to inject application-specific
@@ -58,6 +63,10 @@ public:
   /// Stores the payload.
   message payload;
 
+  /// Selects the message lane for asynchronous messages with default
+  /// priority. Only event-based actors distinguish between lanes.
+  uint8_t lane = 0;
+
   /// Stores a timestamp for when this element got enqueued.
   std::chrono::steady_clock::time_point enqueue_time;
 
@@ -66,6 +75,11 @@ public:
     enqueue_time = std::chrono::steady_clock::now();
   }
 
+  /// Sets `enqueue_time` to `t`.
+  void set_enqueue_time(std::chrono::steady_clock::time_point t) {
+    enqueue_time = t;
+  }
+
   /// Returns the time between enqueueing the message and `t`.
   double seconds_until(std::chrono::steady_clock::time_point t) const {
     namespace ch = std::chrono;
@@ -0,0 +1,43 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace caf {
+
+/// Selects how an actor with a bounded mailbox handles incoming messages
+/// while its mailbox is full. Responses and system messages such as
+/// `exit_msg` always bypass the bound.
+enum class mailbox_overflow_policy : uint8_t {
+  /// Drops incoming messages silently.
+  drop_newest,
+  /// Accepts incoming messages and drops messages at the head of the mailbox
+  /// until the mailbox has no more than the configured number of messages.
+  drop_oldest,
+  /// Drops incoming messages and responds to requests with
+  /// `sec::mailbox_full`.
+  reject,
+  /// Blocks senders that run in their own thread, i.e., blocking actors, until
+  /// the mailbox has capacity again. Accepts messages from all other senders
+  /// immediately, because blocking the scheduler could cause deadlocks.
+  suspend,
+};
+
+} // namespace caf
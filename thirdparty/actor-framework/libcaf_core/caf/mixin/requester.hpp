@@ -19,6 +19,7 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -29,6 +30,8 @@
 #include "caf/message.hpp"
 #include "caf/message_id.hpp"
 #include "caf/message_priority.hpp"
+#include "caf/policy/select_hedged.hpp"
+#include "caf/policy/select_quorum.hpp"
 #include "caf/policy/single_response.hpp"
 #include "caf/response_handle.hpp"
 #include "caf/response_type.hpp"
@@ -118,15 +121,84 @@ public:
       response_type_unbox<signatures_of_t<handle_type>, token>::valid,
       "receiver does not accept given message");
     auto dptr = static_cast<Subtype*>(this);
+    auto ids = send_fan_out_requests<Prio>(destinations, timeout,
+                                           std::forward<Ts>(xs)...);
+    using response_type
+      = response_type_t<typename handle_type::signatures,
+                        detail::implicit_conversions_t<detail::decay_t<Ts>>...>;
+    using result_type = response_handle<Subtype, MergePolicy<response_type>>;
+    return result_type{dptr, std::move(ids)};
+  }
+
+  /// Sends `{xs...}` to each actor in the range `destinations` as a synchronous
+  /// message and combines the first `quorum` responses into a single result.
+  /// Calls the error handler once too many requests failed for reaching the
+  /// quorum.
+  /// @param destinations A container holding handles to all destination actors.
+  /// @param timeout Maximum duration before dropping a request.
+  /// @param quorum Number of required results. Waits for a majority of the
+  ///               responses if `quorum == 0`.
+  /// @returns A helper object that takes response handlers via `.await()`,
+  ///          `.then()`, or `.receive()`.
+  template <message_priority Prio = message_priority::normal, class Rep = int,
+            class Period = std::ratio<1>, class Container, class... Ts>
+  auto quorum_request(const Container& destinations,
+                      std::chrono::duration<Rep, Period> timeout, size_t quorum,
+                      Ts&&... xs) {
+    using handle_type = typename Container::value_type;
+    using namespace detail;
+    static_assert(sizeof...(Ts) > 0, "no message to send");
+    using token = type_list<implicit_conversions_t<decay_t<Ts>>...>;
+    static_assert(
+      response_type_unbox<signatures_of_t<handle_type>, token>::valid,
+      "receiver does not accept given message");
+    auto dptr = static_cast<Subtype*>(this);
+    auto ids = send_fan_out_requests<Prio>(destinations, timeout,
+                                           std::forward<Ts>(xs)...);
+    using response_type
+      = response_type_t<typename handle_type::signatures,
+                        detail::implicit_conversions_t<detail::decay_t<Ts>>...>;
+    using result_type
+      = response_handle<Subtype, policy::select_quorum<response_type>>;
+    return result_type{dptr, std::move(ids), quorum};
+  }
+
+  /// Sends `{xs...}` as a synchronous message to the first actor in
+  /// `destinations`. Sends the same message to the next actor in
+  /// `destinations` whenever no response arrived within `hedge_delay` or when
+  /// a request fails. Picks the first arriving result. Choosing a high
+  /// percentile of the observed latency, e.g., the 95th percentile, as
+  /// `hedge_delay` cuts the tail latency at the cost of few additional
+  /// requests.
+  /// @param destinations A container holding handles to all destination actors
+  ///                     in the order they receive the request.
+  /// @param timeout Maximum duration before dropping a request.
+  /// @param hedge_delay Duration before sending the next request.
+  /// @returns A helper object that takes response handlers via `.then()`.
+  template <message_priority Prio = message_priority::normal, class Rep = int,
+            class Period = std::ratio<1>, class Container, class... Ts>
+  auto hedged_request(const Container& destinations,
+                      std::chrono::duration<Rep, Period> timeout,
+                      timespan hedge_delay, Ts&&... xs) {
+    using handle_type = typename Container::value_type;
+    using namespace detail;
+    static_assert(sizeof...(Ts) > 0, "no message to send");
+    using token = type_list<implicit_conversions_t<decay_t<Ts>>...>;
+    static_assert(
+      response_type_unbox<signatures_of_t<handle_type>, token>::valid,
+      "receiver does not accept given message");
+    auto dptr = static_cast<Subtype*>(this);
+    auto st = std::make_shared<hedged_request_state>();
+    st->content = make_message(std::forward<Ts>(xs)...);
+    st->timeout = timeout;
+    st->hedge_delay = hedge_delay;
     std::vector<message_id> ids;
     ids.reserve(destinations.size());
     for (const auto& dest : destinations) {
       if (!dest)
         continue;
       auto req_id = dptr->new_request_id(Prio);
-      dest->eq_impl(req_id, dptr->ctrl(), dptr->context(),
-                    std::forward<Ts>(xs)...);
-      dptr->request_response_timeout(timeout, req_id);
+      st->requests.emplace_back(actor_cast<strong_actor_ptr>(dest), req_id);
       ids.emplace_back(req_id.response_id());
     }
     if (ids.empty()) {
@@ -134,12 +206,42 @@ public:
       dptr->eq_impl(req_id.response_id(), dptr->ctrl(), dptr->context(),
                     make_error(sec::invalid_argument));
       ids.emplace_back(req_id.response_id());
+    } else {
+      st->send_next(dptr);
     }
     using response_type
       = response_type_t<typename handle_type::signatures,
                         detail::implicit_conversions_t<detail::decay_t<Ts>>...>;
-    using result_type = response_handle<Subtype, MergePolicy<response_type>>;
-    return result_type{dptr, std::move(ids)};
+    using result_type
+      = response_handle<Subtype, policy::select_hedged<response_type>>;
+    return result_type{dptr, std::move(ids), std::move(st)};
+  }
+
+private:
+  template <message_priority Prio, class Container, class Duration,
+            class... Ts>
+  std::vector<message_id> send_fan_out_requests(const Container& destinations,
+                                                Duration timeout,
+                                                Ts&&... xs) {
+    auto dptr = static_cast<Subtype*>(this);
+    std::vector<message_id> ids;
+    ids.reserve(destinations.size());
+    for (const auto& dest : destinations) {
+      if (!dest)
+        continue;
+      auto req_id = dptr->new_request_id(Prio);
+      dest->eq_impl(req_id, dptr->ctrl(), dptr->context(),
+                    std::forward<Ts>(xs)...);
+      dptr->request_response_timeout(timeout, req_id);
+      ids.emplace_back(req_id.response_id());
+    }
+    if (ids.empty()) {
+      auto req_id = dptr->new_request_id(Prio);
+      dptr->eq_impl(req_id.response_id(), dptr->ctrl(), dptr->context(),
+                    make_error(sec::invalid_argument));
+      ids.emplace_back(req_id.response_id());
+    }
+    return ids;
   }
 };
 
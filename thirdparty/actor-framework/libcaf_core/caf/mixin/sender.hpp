@@ -26,6 +26,7 @@
 #include "caf/actor_clock.hpp"
 #include "caf/actor_control_block.hpp"
 #include "caf/check_typed_input.hpp"
+#include "caf/detail/batched_execution_unit.hpp"
 #include "caf/detail/profiled_send.hpp"
 #include "caf/detail/type_traits.hpp"
 #include "caf/fwd.hpp"
@@ -94,6 +95,31 @@ public:
                           self->context(), std::forward<Ts>(xs)...);
   }
 
+  /// Sends `{xs...}` as an asynchronous message to `dest` on the message
+  /// lane `lane`. Receivers that have fewer lanes use their default lane.
+  template <class Dest, class... Ts>
+  detail::enable_if_t<!std::is_same<group, Dest>::value>
+  send_on_lane(uint8_t lane, const Dest& dest, Ts&&... xs) {
+    static_assert(sizeof...(Ts) > 0, "no message to send");
+    static_assert((detail::sendable<Ts> && ...),
+                  "at least one type has no ID, "
+                  "did you forgot to announce it via CAF_ADD_TYPE_ID?");
+    detail::type_list<detail::strip_and_convert_t<Ts>...> args_token;
+    type_check(dest, args_token);
+    auto self = dptr();
+    if (dest) {
+      auto element = make_mailbox_element(self->ctrl(), make_message_id(),
+                                          no_stages, std::forward<Ts>(xs)...);
+      element->lane = lane;
+      tracer::propagate(self->home_system().tracer(),
+                        self->current_mailbox_element(), *element);
+      CAF_BEFORE_SENDING(self, *element);
+      dest->enqueue(std::move(element), self->context());
+    } else {
+      self->home_system().base_metrics().rejected_messages->inc();
+    }
+  }
+
   template <message_priority P = message_priority::normal, class Dest = actor,
             class... Ts>
   void anon_send(const Dest& dest, Ts&&... xs) {
@@ -109,6 +135,59 @@ public:
                           self->context(), std::forward<Ts>(xs)...);
   }
 
+  /// Sends `{xs...}` as an asynchronous message to all `receivers`. All
+  /// mailbox elements share a single message payload and the actor hands all
+  /// receivers that become ready for execution to the scheduler at once.
+  template <message_priority P = message_priority::normal, class Container,
+            class... Ts>
+  void multicast(const Container& receivers, Ts&&... xs) {
+    static_assert(sizeof...(Ts) > 0, "no message to send");
+    static_assert((detail::sendable<Ts> && ...),
+                  "at least one type has no ID, "
+                  "did you forgot to announce it via CAF_ADD_TYPE_ID?");
+    using dest_type = typename Container::value_type;
+    detail::type_list<detail::strip_and_convert_t<Ts>...> args_token;
+    type_check(dest_type{}, args_token);
+    auto self = dptr();
+    detail::batched_execution_unit host{&self->home_system()};
+    host.reserve(receivers.size());
+    auto msg = detail::make_multicast_payload(std::forward<Ts>(xs)...);
+    for (auto& dest : receivers)
+      detail::profiled_send(self, self->ctrl(), dest, make_message_id(P), {},
+                            &host, msg);
+    host.flush();
+  }
+
+  /// Sends all messages in `xs` to `dest`. Actors with a mailbox publish all
+  /// messages with a single atomic operation instead of one per message.
+  template <message_priority P = message_priority::normal, class Dest,
+            class Container>
+  void send_batch(const Dest& dest, const Container& xs) {
+    detail::type_list<message> args_token;
+    type_check(dest, args_token);
+    auto self = dptr();
+    if (!dest) {
+      self->home_system().base_metrics().rejected_messages->inc(
+        static_cast<int64_t>(xs.size()));
+      return;
+    }
+    if (xs.empty())
+      return;
+    auto tr = self->home_system().tracer();
+    auto parent = self->current_mailbox_element();
+    std::vector<mailbox_element_ptr> elements;
+    elements.reserve(xs.size());
+    for (auto& x : xs) {
+      auto element = make_mailbox_element(self->ctrl(), make_message_id(P),
+                                          no_stages, x);
+      tracer::propagate(tr, parent, *element);
+      CAF_BEFORE_SENDING(self, *element);
+      elements.emplace_back(std::move(element));
+    }
+    actor_cast<abstract_actor*>(dest)->enqueue_batch(std::move(elements),
+                                                     self->context());
+  }
+
   /// Sends a message at given time point (or immediately if `timeout` has
   /// passed already).
   template <message_priority P = message_priority::normal, class Dest = actor,
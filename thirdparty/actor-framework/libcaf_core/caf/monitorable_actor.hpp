@@ -116,6 +116,8 @@ protected:
   /// Creates a new actor instance.
   explicit monitorable_actor(actor_config& cfg);
 
+  ~monitorable_actor() override;
+
   /****************************************************************************
    *                 here be dragons: end of public interface                 *
    ****************************************************************************/
@@ -126,6 +128,16 @@ protected:
     attachables_head_.swap(ptr);
   }
 
+  attachable* attachables_closed_tag() const noexcept {
+    // We are *never* going to dereference the returned pointer. It is only
+    // used as indicator whether this actor has released its attachables.
+    return reinterpret_cast<attachable*>(reinterpret_cast<intptr_t>(this) + 1);
+  }
+
+  // moves all functors from `pending_attachables_` to `attachables_head_`
+  // precondition: `mtx_` is acquired
+  void drain_pending_attachables();
+
   // precondition: `mtx_` is acquired
   size_t detach_impl(const attachable::token& what, bool stop_on_hit = false,
                      bool dry_run = false);
@@ -157,6 +169,10 @@ protected:
   // attached functors that are executed on cleanup (monitors, links, etc)
   attachable_ptr attachables_head_;
 
+  // lock-free stack of functors added via `attach` that have not been moved
+  // to `attachables_head_` yet; set to `attachables_closed_tag()` on cleanup
+  std::atomic<attachable*> pending_attachables_;
+
   /// @endcond
 };
 
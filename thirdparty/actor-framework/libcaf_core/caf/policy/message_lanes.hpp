@@ -0,0 +1,161 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <vector>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/fwd.hpp"
+#include "caf/intrusive/drr_cached_queue.hpp"
+#include "caf/mailbox_element.hpp"
+#include "caf/unit.hpp"
+
+namespace caf::policy {
+
+/// Configures a dynamic WDRR queue for holding asynchronous messages with
+/// default priority. The queue holds one nested queue per message lane and
+/// each lane receives a multiple of the quantum according to its weight.
+class CAF_CORE_EXPORT message_lanes {
+public:
+  // -- nested types -----------------------------------------------------------
+
+  /// Configures a cached DRR queue for a single lane.
+  class CAF_CORE_EXPORT nested {
+  public:
+    // -- member types ---------------------------------------------------------
+
+    using mapped_type = mailbox_element;
+
+    using task_size_type = size_t;
+
+    using deficit_type = size_t;
+
+    using unique_pointer = mailbox_element_ptr;
+
+    // -- constructors, destructors, and assignment operators ------------------
+
+    explicit nested(size_t weight = 1) noexcept : weight(weight) {
+      // nop
+    }
+
+    // -- interface required by drr_cached_queue -------------------------------
+
+    static task_size_type task_size(const mailbox_element&) noexcept {
+      return 1;
+    }
+
+    // -- member variables -----------------------------------------------------
+
+    /// Multiplies the quantum of this lane in each round.
+    size_t weight;
+  };
+
+  // -- member types -----------------------------------------------------------
+
+  using mapped_type = mailbox_element;
+
+  using task_size_type = size_t;
+
+  using deficit_type = size_t;
+
+  using pointer = mapped_type*;
+
+  using unique_pointer = mailbox_element_ptr;
+
+  using key_type = uint8_t;
+
+  using nested_queue_type = intrusive::drr_cached_queue<nested>;
+
+  using queue_map_type = std::map<key_type, nested_queue_type>;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  message_lanes() = default;
+
+  message_lanes(const message_lanes&) = default;
+
+  message_lanes& operator=(const message_lanes&) = default;
+
+  constexpr message_lanes(unit_t) {
+    // nop
+  }
+
+  // -- required functions for wdrr_dynamic_multiplexed_queue ------------------
+
+  key_type id_of(const mailbox_element& x) const noexcept {
+    // Messages for unknown lanes go to the default lane.
+    return x.lane < num_lanes ? x.lane : key_type{0};
+  }
+
+  static bool enabled(const nested_queue_type&) noexcept {
+    return true;
+  }
+
+  static deficit_type quantum(const nested_queue_type& q,
+                              deficit_type x) noexcept {
+    return x * q.policy().weight;
+  }
+
+  static void cleanup(nested_queue_type&) noexcept {
+    // nop
+  }
+
+  static bool push_back(nested_queue_type& sub_queue, pointer ptr) noexcept {
+    return sub_queue.push_back(ptr);
+  }
+
+  static void lifo_append(nested_queue_type& sub_queue, pointer ptr) noexcept {
+    sub_queue.lifo_append(ptr);
+  }
+
+  static void stop_lifo_append(nested_queue_type& sub_queue) noexcept {
+    sub_queue.stop_lifo_append();
+  }
+
+  // -- lane management --------------------------------------------------------
+
+  /// Adds lanes to `qs` until it contains one lane per element in `weights`
+  /// and assigns `weights[i]` to lane `i`. Never removes lanes. Treats a
+  /// weight of 0 as 1 to prevent starvation.
+  void set_weights(queue_map_type& qs, const std::vector<size_t>& weights) {
+    auto n = std::min(weights.size(),
+                      size_t{std::numeric_limits<key_type>::max()} + 1);
+    for (size_t i = 0; i < n; ++i) {
+      auto key = static_cast<key_type>(i);
+      auto weight = std::max(weights[i], size_t{1});
+      if (auto j = qs.find(key); j != qs.end())
+        j->second.policy().weight = weight;
+      else
+        qs.emplace(key, nested_queue_type{nested{weight}});
+    }
+    num_lanes = qs.size();
+  }
+
+  // -- member variables -------------------------------------------------------
+
+  /// Stores how many lanes the queue map contains. Lanes always use the keys
+  /// 0 to `num_lanes - 1`.
+  size_t num_lanes = 0;
+};
+
+} // namespace caf::policy
@@ -42,6 +42,10 @@ public:
   template <class Coordinator>
   void central_enqueue(Coordinator* self, resumable* job);
 
+  /// Enqueues multiple new jobs to coordinator at once.
+  template <class Coordinator>
+  void central_enqueue_all(Coordinator* self, span<resumable* const> jobs);
+
   /// Enqueues a new job to the worker's queue from an
   /// external source, i.e., from any other thread.
   template <class Worker>
@@ -0,0 +1,186 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "caf/actor_control_block.hpp"
+#include "caf/behavior.hpp"
+#include "caf/config.hpp"
+#include "caf/detail/type_traits.hpp"
+#include "caf/detail/typed_actor_util.hpp"
+#include "caf/error.hpp"
+#include "caf/logger.hpp"
+#include "caf/mailbox_element.hpp"
+#include "caf/message.hpp"
+#include "caf/message_id.hpp"
+#include "caf/message_priority.hpp"
+#include "caf/policy/select_any.hpp"
+#include "caf/sec.hpp"
+#include "caf/timespan.hpp"
+
+namespace caf::detail {
+
+/// Stores the destinations and the content of a hedged request.
+struct hedged_request_state {
+  /// Stores the content for all requests.
+  message content;
+
+  /// Stores all destinations with their pre-allocated request ID.
+  std::vector<std::pair<strong_actor_ptr, message_id>> requests;
+
+  /// Stores the number of requests that have been sent.
+  size_t sent = 0;
+
+  /// Configures the timeout for each individual request.
+  timespan timeout = infinite;
+
+  /// Configures how long to wait for a response before sending the next
+  /// request.
+  timespan hedge_delay = infinite;
+
+  bool has_next() const noexcept {
+    return sent < requests.size();
+  }
+
+  /// Sends the next request.
+  template <class Self>
+  void send_next(Self* self) {
+    CAF_ASSERT(has_next());
+    auto& [dest, req_id] = requests[sent++];
+    CAF_LOG_DEBUG("send hedged request:" << CAF_ARG(dest) << CAF_ARG(req_id));
+    dest->enqueue(make_mailbox_element(self->ctrl(), req_id, {}, content),
+                  self->context());
+    self->request_response_timeout(timeout, req_id);
+  }
+
+  /// Drops all requests that have not been sent yet by responding to them
+  /// locally.
+  template <class Self>
+  void drop_remaining(Self* self) {
+    for (; sent < requests.size(); ++sent)
+      self->eq_impl(requests[sent].second.response_id(), self->ctrl(),
+                    self->context(), make_error(sec::request_timeout));
+  }
+};
+
+} // namespace caf::detail
+
+namespace caf::policy {
+
+/// Enables a `response_handle` to pick the first arriving response of a
+/// hedged request. Hedged requests go to one destination at first and only
+/// send a duplicate request to the next destination if no response arrived
+/// within the hedge delay or if the previous request failed. Calls the error
+/// handler with `sec::all_requests_failed` if all requests failed.
+/// @note Hedged requests depend on multiplexed response handlers, i.e., this
+///       policy only supports `then`.
+/// @relates mixin::requester
+/// @relates response_handle
+template <class ResponseType>
+class select_hedged {
+public:
+  static constexpr bool is_trivial = false;
+
+  using response_type = ResponseType;
+
+  using message_id_list = std::vector<message_id>;
+
+  using state_ptr = std::shared_ptr<detail::hedged_request_state>;
+
+  template <class Fun>
+  using type_checker
+    = detail::type_checker<response_type, detail::decay_t<Fun>>;
+
+  select_hedged(message_id_list ids, state_ptr st)
+    : ids_(std::move(ids)), state_(std::move(st)) {
+    CAF_ASSERT(ids_.size()
+               <= static_cast<size_t>(std::numeric_limits<int>::max()));
+  }
+
+  template <class Self, class F, class OnError>
+  void then(Self* self, F&& f, OnError&& g) const {
+    CAF_LOG_TRACE(CAF_ARG(ids_));
+    using factory = detail::select_any_factory<std::decay_t<F>>;
+    auto pending = std::make_shared<size_t>(ids_.size());
+    auto st = state_;
+    auto error_handler = [self, st, pending,
+                          g{std::forward<OnError>(g)}](error&) mutable {
+      if (*pending == 0) {
+        // nop
+      } else if (*pending == 1) {
+        *pending = 0;
+        auto err = make_error(sec::all_requests_failed);
+        g(err);
+      } else {
+        --*pending;
+        // Don't wait for the hedge delay if a request fails.
+        if (st && st->has_next())
+          st->send_next(self);
+      }
+    };
+    behavior bhvr{
+      factory::make(pending, std::forward<F>(f)),
+      std::move(error_handler),
+    };
+    for (auto id : ids_)
+      self->add_multiplexed_response_handler(id, bhvr);
+    if (st && st->has_next())
+      schedule_next(self, std::move(st), std::move(pending));
+  }
+
+  const message_id_list& ids() const noexcept {
+    return ids_;
+  }
+
+private:
+  // Uses a response timeout for waking up the actor after the hedge delay.
+  template <class Self>
+  static void
+  schedule_next(Self* self, state_ptr st, std::shared_ptr<size_t> pending) {
+    if (st->hedge_delay == infinite)
+      return;
+    auto trigger_id = self->new_request_id(message_priority::normal);
+    self->request_response_timeout(st->hedge_delay, trigger_id);
+    behavior bhvr{
+      [self, st, pending](error&) {
+        if (*pending == 0) {
+          st->drop_remaining(self);
+          return;
+        }
+        if (st->has_next())
+          st->send_next(self);
+        if (st->has_next())
+          schedule_next(self, st, pending);
+      },
+    };
+    self->add_multiplexed_response_handler(trigger_id.response_id(),
+                                           std::move(bhvr));
+  }
+
+  message_id_list ids_;
+
+  state_ptr state_;
+};
+
+} // namespace caf::policy
@@ -0,0 +1,185 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "caf/behavior.hpp"
+#include "caf/config.hpp"
+#include "caf/detail/type_list.hpp"
+#include "caf/detail/type_traits.hpp"
+#include "caf/detail/typed_actor_util.hpp"
+#include "caf/error.hpp"
+#include "caf/logger.hpp"
+#include "caf/message_id.hpp"
+#include "caf/policy/select_all.hpp"
+#include "caf/sec.hpp"
+
+namespace caf::detail {
+
+template <class F, class T>
+struct select_partial_state {
+  std::vector<T> results;
+  size_t pending;
+  F f;
+
+  template <class Fun>
+  select_partial_state(size_t pending, Fun&& f)
+    : pending(pending), f(std::forward<Fun>(f)) {
+    results.reserve(pending);
+  }
+
+  // Called for each failed request. Delivers all results after the last
+  // pending request completed or calls `g` if none of the requests succeeded.
+  template <class OnError>
+  void drop_one(OnError& g) {
+    CAF_LOG_TRACE(CAF_ARG(pending));
+    if (pending == 0 || --pending > 0)
+      return;
+    if (results.empty()) {
+      auto err = make_error(sec::all_requests_failed);
+      g(err);
+    } else {
+      f(std::move(results));
+    }
+  }
+};
+
+template <class F, class = typename get_callable_trait<F>::arg_types>
+struct select_partial_factory;
+
+template <class F, class T>
+struct select_partial_factory<F, type_list<std::vector<T>>> {
+  using state_type = select_partial_state<F, T>;
+
+  static auto make_handler(std::shared_ptr<state_type> st) {
+    return [st{std::move(st)}](T& x) {
+      if (st->pending > 0) {
+        st->results.emplace_back(std::move(x));
+        if (--st->pending == 0)
+          st->f(std::move(st->results));
+      }
+    };
+  }
+};
+
+template <class F, class... Ts>
+struct select_partial_factory<F, type_list<std::vector<std::tuple<Ts...>>>> {
+  using state_type = select_partial_state<F, std::tuple<Ts...>>;
+
+  static auto make_handler(std::shared_ptr<state_type> st) {
+    return [st{std::move(st)}](Ts&... xs) {
+      if (st->pending > 0) {
+        st->results.emplace_back(std::move(xs)...);
+        if (--st->pending == 0)
+          st->f(std::move(st->results));
+      }
+    };
+  }
+};
+
+} // namespace caf::detail
+
+namespace caf::policy {
+
+/// Enables a `response_handle` to fan-in all successful responses into a
+/// single result (a `vector` that stores all received results). Unlike
+/// `select_all`, this policy ignores failed requests as long as at least one
+/// request succeeds. In combination with a timeout, this policy delivers
+/// partial results instead of failing when some receivers do not respond in
+/// time. Calls the error handler with `sec::all_requests_failed` if none of
+/// the requests succeeded.
+/// @relates mixin::requester
+/// @relates response_handle
+template <class ResponseType>
+class select_partial {
+public:
+  static constexpr bool is_trivial = false;
+
+  using response_type = ResponseType;
+
+  using message_id_list = std::vector<message_id>;
+
+  template <class Fun>
+  using type_checker
+    = detail::type_checker<response_type,
+                           detail::select_all_helper_t<detail::decay_t<Fun>>>;
+
+  explicit select_partial(message_id_list ids) : ids_(std::move(ids)) {
+    CAF_ASSERT(ids_.size()
+               <= static_cast<size_t>(std::numeric_limits<int>::max()));
+  }
+
+  select_partial(select_partial&&) noexcept = default;
+
+  select_partial& operator=(select_partial&&) noexcept = default;
+
+  template <class Self, class F, class OnError>
+  void await(Self* self, F&& f, OnError&& g) const {
+    CAF_LOG_TRACE(CAF_ARG(ids_));
+    auto bhvr = make_behavior(std::forward<F>(f), std::forward<OnError>(g));
+    for (auto id : ids_)
+      self->add_awaited_response_handler(id, bhvr);
+  }
+
+  template <class Self, class F, class OnError>
+  void then(Self* self, F&& f, OnError&& g) const {
+    CAF_LOG_TRACE(CAF_ARG(ids_));
+    auto bhvr = make_behavior(std::forward<F>(f), std::forward<OnError>(g));
+    for (auto id : ids_)
+      self->add_multiplexed_response_handler(id, bhvr);
+  }
+
+  template <class Self, class F, class G>
+  void receive(Self* self, F&& f, G&& g) const {
+    CAF_LOG_TRACE(CAF_ARG(ids_));
+    auto bhvr = make_behavior(std::forward<F>(f), std::forward<G>(g));
+    for (auto id : ids_) {
+      typename Self::accept_one_cond rc;
+      self->varargs_receive(rc, id, bhvr);
+    }
+  }
+
+  const message_id_list& ids() const noexcept {
+    return ids_;
+  }
+
+private:
+  template <class F, class OnError>
+  behavior make_behavior(F&& f, OnError&& g) const {
+    using factory = detail::select_partial_factory<std::decay_t<F>>;
+    using state_type = typename factory::state_type;
+    auto st = std::make_shared<state_type>(ids_.size(), std::forward<F>(f));
+    auto error_handler = [st, g{std::forward<OnError>(g)}](error&) mutable {
+      st->drop_one(g);
+    };
+    return {
+      factory::make_handler(st),
+      std::move(error_handler),
+    };
+  }
+
+  message_id_list ids_;
+};
+
+} // namespace caf::policy
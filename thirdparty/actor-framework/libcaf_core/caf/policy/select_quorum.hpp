@@ -0,0 +1,160 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "caf/behavior.hpp"
+#include "caf/config.hpp"
+#include "caf/detail/type_traits.hpp"
+#include "caf/detail/typed_actor_util.hpp"
+#include "caf/error.hpp"
+#include "caf/logger.hpp"
+#include "caf/message_id.hpp"
+#include "caf/policy/select_all.hpp"
+
+namespace caf::policy {
+
+/// Enables a `response_handle` to fan-in the first `k` responses into a single
+/// result (a `vector` that stores `k` results). Calls the error handler once
+/// too many requests failed for reaching the quorum, passing the error that
+/// made the quorum unreachable. Defaults to a majority quorum when
+/// constructed from a list of IDs only.
+/// @relates mixin::requester
+/// @relates response_handle
+template <class ResponseType>
+class select_quorum {
+public:
+  static constexpr bool is_trivial = false;
+
+  using response_type = ResponseType;
+
+  using message_id_list = std::vector<message_id>;
+
+  template <class Fun>
+  using type_checker
+    = detail::type_checker<response_type,
+                           detail::select_all_helper_t<detail::decay_t<Fun>>>;
+
+  explicit select_quorum(message_id_list ids)
+    : select_quorum(std::move(ids), 0) {
+    // nop
+  }
+
+  /// @param quorum The number of results required for calling the result
+  ///               handler. Waits for a majority of the responses if
+  ///               `quorum == 0` and for all responses if `quorum` exceeds
+  ///               the number of requests.
+  select_quorum(message_id_list ids, size_t quorum) : ids_(std::move(ids)) {
+    CAF_ASSERT(ids_.size()
+               <= static_cast<size_t>(std::numeric_limits<int>::max()));
+    quorum_ = quorum == 0 ? ids_.size() / 2 + 1
+                          : std::min(quorum, ids_.size());
+  }
+
+  select_quorum(select_quorum&&) noexcept = default;
+
+  select_quorum& operator=(select_quorum&&) noexcept = default;
+
+  template <class Self, class F, class OnError>
+  void await(Self* self, F&& f, OnError&& g) const {
+    CAF_LOG_TRACE(CAF_ARG(ids_) << CAF_ARG(quorum_));
+    auto bhvr = make_behavior(std::forward<F>(f), std::forward<OnError>(g));
+    for (auto id : ids_)
+      self->add_awaited_response_handler(id, bhvr);
+  }
+
+  template <class Self, class F, class OnError>
+  void then(Self* self, F&& f, OnError&& g) const {
+    CAF_LOG_TRACE(CAF_ARG(ids_) << CAF_ARG(quorum_));
+    auto bhvr = make_behavior(std::forward<F>(f), std::forward<OnError>(g));
+    for (auto id : ids_)
+      self->add_multiplexed_response_handler(id, bhvr);
+  }
+
+  template <class Self, class F, class G>
+  void receive(Self* self, F&& f, G&& g) const {
+    CAF_LOG_TRACE(CAF_ARG(ids_) << CAF_ARG(quorum_));
+    using helper_type = detail::select_all_helper_t<detail::decay_t<F>>;
+    helper_type helper{quorum_, std::forward<F>(f)};
+    auto failures = ids_.size() - quorum_;
+    auto error_handler = [&](error& err) {
+      if (*helper.pending > 0) {
+        if (failures > 0) {
+          --failures;
+        } else {
+          *helper.pending = 0;
+          helper.results.clear();
+          g(err);
+        }
+      }
+    };
+    for (auto id : ids_) {
+      typename Self::accept_one_cond rc;
+      auto error_handler_copy = error_handler;
+      self->varargs_receive(rc, id, helper.wrap(), error_handler_copy);
+    }
+  }
+
+  const message_id_list& ids() const noexcept {
+    return ids_;
+  }
+
+  size_t quorum() const noexcept {
+    return quorum_;
+  }
+
+private:
+  template <class F, class OnError>
+  behavior make_behavior(F&& f, OnError&& g) const {
+    using namespace detail;
+    using helper_type = select_all_helper_t<decay_t<F>>;
+    helper_type helper{quorum_, std::move(f)};
+    auto pending = helper.pending;
+    auto failures = std::make_shared<size_t>(ids_.size() - quorum_);
+    auto error_handler = [pending{std::move(pending)},
+                          failures{std::move(failures)},
+                          g{std::forward<OnError>(g)}](error& err) mutable {
+      CAF_LOG_TRACE(CAF_ARG2("pending", *pending)
+                    << CAF_ARG2("failures", *failures));
+      if (*pending > 0) {
+        if (*failures > 0) {
+          --*failures;
+        } else {
+          *pending = 0;
+          g(err);
+        }
+      }
+    };
+    return {
+      std::move(helper),
+      std::move(error_handler),
+    };
+  }
+
+  message_id_list ids_;
+
+  size_t quorum_;
+};
+
+} // namespace caf::policy
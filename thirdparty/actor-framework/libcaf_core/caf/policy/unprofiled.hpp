@@ -32,6 +32,13 @@ class CAF_CORE_EXPORT unprofiled {
 public:
   virtual ~unprofiled();
 
+  /// Called once after constructing a worker, i.e., before the worker starts
+  /// its thread.
+  template <class Worker>
+  void init_worker(Worker*) {
+    // nop
+  }
+
   /// Performs cleanup action before a shutdown takes place.
   template <class Worker>
   void before_shutdown(Worker*) {
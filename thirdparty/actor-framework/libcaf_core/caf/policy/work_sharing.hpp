@@ -26,6 +26,7 @@
 #include "caf/detail/core_export.hpp"
 #include "caf/policy/unprofiled.hpp"
 #include "caf/resumable.hpp"
+#include "caf/span.hpp"
 
 namespace caf::policy {
 
@@ -68,6 +69,14 @@ public:
     enqueue(self, job);
   }
 
+  template <class Coordinator>
+  void central_enqueue_all(Coordinator* self, span<resumable* const> jobs) {
+    queue_type l{jobs.begin(), jobs.end()};
+    std::unique_lock<std::mutex> guard(d(self).lock);
+    d(self).queue.splice(d(self).queue.end(), l);
+    d(self).cv.notify_all();
+  }
+
   template <class Worker>
   void external_enqueue(Worker* self, resumable* job) {
     enqueue(self->parent(), job);
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <chrono>
 #include <condition_variable>
@@ -32,6 +33,9 @@
 #include "caf/detail/double_ended_queue.hpp"
 #include "caf/policy/unprofiled.hpp"
 #include "caf/resumable.hpp"
+#include "caf/span.hpp"
+#include "caf/telemetry/counter.hpp"
+#include "caf/telemetry/gauge.hpp"
 #include "caf/timespan.hpp"
 
 namespace caf::policy {
@@ -60,6 +64,22 @@ public:
     bool sleeping{false};
   };
 
+  // Metric instances of a single worker, labeled with the worker ID.
+  struct worker_metrics {
+    // Counts how many jobs the worker resumed.
+    telemetry::int_counter* resumes = nullptr;
+    // Counts how many jobs the worker stole from others.
+    telemetry::int_counter* steals = nullptr;
+    // Counts how many steal attempts of the worker came back empty-handed.
+    telemetry::int_counter* failed_steals = nullptr;
+    // Counts how many jobs other workers stole from this worker.
+    telemetry::int_counter* migrated_jobs = nullptr;
+    // Accumulates the time the worker spent sleeping while waiting for jobs.
+    telemetry::dbl_counter* parked_time = nullptr;
+    // Tracks the number of jobs in the queue of the worker.
+    telemetry::int_gauge* queue_size = nullptr;
+  };
+
   // The coordinator has only a counter for round-robin enqueue to its workers.
   struct coordinator_data {
     explicit coordinator_data(scheduler::abstract_coordinator*)
@@ -83,8 +103,25 @@ public:
     std::uniform_int_distribution<size_t> uniform;
     std::array<poll_strategy, 3> strategies;
     wait_strategy waitdata;
+    // Initialized by `init_worker`, i.e., before the worker starts running.
+    worker_metrics metrics;
   };
 
+  // Returns the metric instances for the worker with ID `worker_id`.
+  static worker_metrics make_worker_metrics(telemetry::metric_registry& reg,
+                                            size_t worker_id);
+
+  template <class Worker>
+  void init_worker(Worker* self) {
+    d(self).metrics = make_worker_metrics(self->system().metrics(),
+                                          self->id());
+  }
+
+  template <class Worker>
+  void before_resume(Worker* self, resumable*) {
+    d(self).metrics.resumes->inc();
+  }
+
   // Goes on a raid in quest for a shiny new job.
   template <class Worker>
   resumable* try_steal(Worker* self) {
@@ -98,7 +135,49 @@ public:
     if (victim == self->id())
       victim = p->num_workers() - 1;
     // steal oldest element from the victim's queue
-    return d(p->worker_by_id(victim)).queue.take_tail();
+    auto& victim_data = d(p->worker_by_id(victim));
+    auto job = victim_data.queue.take_tail();
+    if (job == nullptr) {
+      d(self).metrics.failed_steals->inc();
+      return nullptr;
+    }
+    d(self).metrics.steals->inc();
+    victim_data.metrics.migrated_jobs->inc();
+    victim_data.metrics.queue_size->dec();
+    return job;
+  }
+
+  // Sleeps for `duration` while accounting the time as parked.
+  template <class Worker>
+  void park(Worker* self, timespan duration) {
+    auto t0 = std::chrono::steady_clock::now();
+#ifdef CAF_MSVC
+    // Windows cannot sleep less than 1000 us, so timeout is converted to 0
+    // inside sleep_for(), but Sleep(0) is dangerous so replace it with yield()
+    if (duration.count() < 1000)
+      std::this_thread::yield();
+    else
+      std::this_thread::sleep_for(duration);
+#else
+    std::this_thread::sleep_for(duration);
+#endif
+    add_parked_time(self, t0);
+  }
+
+  template <class Worker>
+  void add_parked_time(Worker* self, std::chrono::steady_clock::time_point t0) {
+    using fractional_seconds = std::chrono::duration<double>;
+    auto t1 = std::chrono::steady_clock::now();
+    d(self).metrics.parked_time->inc(fractional_seconds{t1 - t0}.count());
+  }
+
+  // Takes the next job from the queue of `self`.
+  template <class Worker>
+  resumable* take_head(Worker* self) {
+    auto job = d(self).queue.take_head();
+    if (job != nullptr)
+      d(self).metrics.queue_size->dec();
+    return job;
   }
 
   template <class Coordinator>
@@ -107,9 +186,31 @@ public:
     w->external_enqueue(job);
   }
 
+  template <class Coordinator>
+  void central_enqueue_all(Coordinator* self, span<resumable* const> jobs) {
+    // Hand out the jobs in contiguous chunks to wake up each worker only once.
+    auto num_workers = self->num_workers();
+    auto chunk_size = (jobs.size() + num_workers - 1) / num_workers;
+    while (!jobs.empty()) {
+      auto chunk = jobs.first(std::min(chunk_size, jobs.size()));
+      auto w = self->worker_by_id(d(self).next_worker++ % num_workers);
+      d(w).metrics.queue_size->inc(static_cast<int64_t>(chunk.size()));
+      for (auto job : chunk)
+        d(w).queue.append(job);
+      wake_up(w);
+      jobs = jobs.subspan(chunk.size());
+    }
+  }
+
   template <class Worker>
   void external_enqueue(Worker* self, resumable* job) {
+    d(self).metrics.queue_size->inc();
     d(self).queue.append(job);
+    wake_up(self);
+  }
+
+  template <class Worker>
+  void wake_up(Worker* self) {
     auto& lock = d(self).waitdata.lock;
     auto& cv = d(self).waitdata.cv;
     { // guard scope
@@ -122,6 +223,7 @@ public:
 
   template <class Worker>
   void internal_enqueue(Worker* self, resumable* job) {
+    d(self).metrics.queue_size->inc();
     d(self).queue.prepend(job);
   }
 
@@ -129,6 +231,7 @@ public:
   void resume_job_later(Worker* self, resumable* job) {
     // job has voluntarily released the CPU to let others run instead
     // this means we are going to put this job to the very end of our queue
+    d(self).metrics.queue_size->inc();
     d(self).queue.append(job);
   }
 
@@ -143,7 +246,7 @@ public:
     for (size_t k = 0; k < 2; ++k) { // iterate over the first two strategies
       for (size_t i = 0; i < strategies[k].attempts;
            i += strategies[k].step_size) {
-        job = d(self).queue.take_head();
+        job = take_head(self);
         if (job)
           return job;
         // try to steal every X poll attempts
@@ -152,19 +255,8 @@ public:
           if (job)
             return job;
         }
-        if (strategies[k].sleep_duration.count() > 0) {
-#ifdef CAF_MSVC
-          // Windows cannot sleep less than 1000 us, so timeout is converted to
-          // 0 inside sleep_for(), but Sleep(0) is dangerous so replace it with
-          // yield()
-          if (strategies[k].sleep_duration.count() < 1000)
-            std::this_thread::yield();
-          else
-            std::this_thread::sleep_for(strategies[k].sleep_duration);
-#else
-          std::this_thread::sleep_for(strategies[k].sleep_duration);
-#endif
-        }
+        if (strategies[k].sleep_duration.count() > 0)
+          park(self, strategies[k].sleep_duration);
       }
     }
     // we assume pretty much nothing is going on so we can relax polling
@@ -178,15 +270,17 @@ public:
     size_t i = 1;
     do {
       { // guard scope
+        auto t0 = std::chrono::steady_clock::now();
         std::unique_lock<std::mutex> guard(lock);
         sleeping = true;
         if (!cv.wait_for(guard, relaxed.sleep_duration,
                          [&] { return !d(self).queue.empty(); }))
           notimeout = false;
         sleeping = false;
+        add_parked_time(self, t0);
       }
       if (notimeout) {
-        job = d(self).queue.take_head();
+        job = take_head(self);
       } else {
         notimeout = true;
         if ((i % relaxed.steal_interval) == 0)
@@ -199,7 +293,7 @@ public:
 
   template <class Worker, class UnaryFunction>
   void foreach_resumable(Worker* self, UnaryFunction f) {
-    auto next = [&] { return d(self).queue.take_head(); };
+    auto next = [&] { return take_head(self); };
     for (auto job = next(); job != nullptr; job = next()) {
       f(job);
     }
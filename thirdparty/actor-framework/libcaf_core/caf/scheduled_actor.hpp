@@ -24,6 +24,7 @@
 #  include <exception>
 #endif // CAF_ENABLE_EXCEPTIONS
 
+#include <atomic>
 #include <forward_list>
 #include <map>
 #include <type_traits>
@@ -32,7 +33,6 @@
 #include "caf/actor_traits.hpp"
 #include "caf/detail/behavior_stack.hpp"
 #include "caf/detail/core_export.hpp"
-#include "caf/detail/unordered_flat_map.hpp"
 #include "caf/error.hpp"
 #include "caf/extend.hpp"
 #include "caf/fwd.hpp"
@@ -45,6 +45,7 @@
 #include "caf/invoke_message_result.hpp"
 #include "caf/local_actor.hpp"
 #include "caf/logger.hpp"
+#include "caf/mailbox_overflow_policy.hpp"
 #include "caf/mixin/behavior_changer.hpp"
 #include "caf/mixin/requester.hpp"
 #include "caf/mixin/sender.hpp"
@@ -52,6 +53,7 @@
 #include "caf/policy/arg.hpp"
 #include "caf/policy/categorized.hpp"
 #include "caf/policy/downstream_messages.hpp"
+#include "caf/policy/message_lanes.hpp"
 #include "caf/policy/normal_messages.hpp"
 #include "caf/policy/upstream_messages.hpp"
 #include "caf/policy/urgent_messages.hpp"
@@ -127,8 +129,9 @@ public:
   /// Maps slot IDs to stream managers.
   using stream_manager_map = std::map<stream_slot, stream_manager_ptr>;
 
-  /// Stores asynchronous messages with default priority.
-  using normal_queue = intrusive::drr_cached_queue<policy::normal_messages>;
+  /// Stores asynchronous messages with default priority in weighted lanes.
+  using normal_queue
+    = intrusive::wdrr_dynamic_multiplexed_queue<policy::message_lanes>;
 
   /// Stores asynchronous messages with hifh priority.
   using urgent_queue = intrusive::drr_cached_queue<policy::urgent_messages>;
@@ -147,8 +150,9 @@ public:
   ///   3. Upstream messages
   ///   4. Downstream messages
   ///
-  /// The queue for downstream messages is in turn composed of a nested queues,
-  /// one for each active input slot.
+  /// The queue for default asynchronous messages is in turn composed of nested
+  /// queues, one for each message lane. Likewise, the queue for downstream
+  /// messages is composed of nested queues, one for each active input slot.
   struct mailbox_policy {
     using deficit_type = size_t;
 
@@ -233,8 +237,15 @@ public:
 
   void enqueue(mailbox_element_ptr ptr, execution_unit* eu) override;
 
+  void enqueue_batch(std::vector<mailbox_element_ptr> xs,
+                     execution_unit* eu) override;
+
   mailbox_element* peek_at_next_mailbox_element() override;
 
+  size_t mailbox_size_hint() const noexcept override {
+    return mailbox_size_hint_.load(std::memory_order_relaxed);
+  }
+
   // -- overridden functions of local_actor ------------------------------------
 
   const char* name() const override;
@@ -290,6 +301,39 @@ public:
     return pending_stream_managers_;
   }
 
+  /// Enables counting of incoming messages for `mailbox_size_hint`. Allows
+  /// senders such as load-aware actor pools to estimate the mailbox size of
+  /// this actor without accessing the mailbox itself.
+  void track_mailbox_size() noexcept {
+    tracks_mailbox_size_.store(true, std::memory_order_relaxed);
+  }
+
+  /// Bounds the mailbox of this actor to approximately `capacity` messages,
+  /// whereas `policy` selects how the actor handles messages beyond this
+  /// capacity. Passing 0 for `capacity` makes the mailbox unbounded again.
+  /// @note Senders check the capacity without synchronizing with each other.
+  ///       Hence, concurrent senders may exceed the capacity by a few messages.
+  void set_mailbox_capacity(size_t capacity,
+                            mailbox_overflow_policy policy
+                            = mailbox_overflow_policy::drop_newest) noexcept;
+
+  /// Returns the capacity of the mailbox or 0 if the mailbox is unbounded.
+  size_t mailbox_capacity() const noexcept {
+    return mailbox_capacity_.load(std::memory_order_relaxed);
+  }
+
+  /// Configures one message lane per element in `weights`. In each scheduling
+  /// round, lane `i` may consume `weights[i]` times as many messages as a lane
+  /// with weight 1. Messages for lanes that do not exist go to lane 0. Never
+  /// removes lanes, i.e., passing fewer weights only updates the first lanes.
+  /// @warning Call only from this actor, e.g., in its constructor.
+  void set_message_lanes(const std::vector<size_t>& weights);
+
+  /// Returns the number of message lanes.
+  size_t num_message_lanes() noexcept {
+    return get_normal_queue().policy().num_lanes;
+  }
+
   // -- actor metrics ----------------------------------------------------------
 
   inbound_stream_metrics_t inbound_stream_metrics(type_id_t type);
@@ -661,8 +705,9 @@ protected:
   /// Stores callbacks for awaited responses.
   std::forward_list<pending_response> awaited_responses_;
 
-  /// Stores callbacks for multiplexed responses.
-  detail::unordered_flat_map<message_id, behavior> multiplexed_responses_;
+  /// Stores callbacks for multiplexed responses. Actors may have thousands of
+  /// pending requests, so we need constant-time lookups and removals here.
+  std::unordered_map<message_id, behavior> multiplexed_responses_;
 
   /// Customization point for setting a default `message` callback.
   default_handler default_handler_;
@@ -702,23 +747,62 @@ protected:
   /// Caches metric objects for outbound stream traffic.
   outbound_stream_metrics_map outbound_stream_metrics_;
 
+  /// Configures whether `enqueue` increments `mailbox_size_hint_`.
+  std::atomic<bool> tracks_mailbox_size_;
+
+  /// Approximates the number of messages in the mailbox. Senders increment
+  /// this counter before enqueueing a message and only this actor decrements
+  /// it, i.e., the counter never drops below zero.
+  std::atomic<size_t> mailbox_size_hint_;
+
+  /// Stores the capacity for bounded mailboxes or 0 for unbounded mailboxes.
+  std::atomic<size_t> mailbox_capacity_;
+
+  /// Selects how `enqueue` handles messages beyond `mailbox_capacity_`.
+  std::atomic<mailbox_overflow_policy> mailbox_overflow_;
+
 #ifdef CAF_ENABLE_EXCEPTIONS
   /// Customization point for setting a default exception callback.
   exception_handler exception_handler_;
 #endif // CAF_ENABLE_EXCEPTIONS
 
 private:
+  /// Decides whether `x` may enter a full bounded mailbox.
+  bool admit_to_full_mailbox(mailbox_element& x, execution_unit* eu);
+
+  /// Drops `x` instead of processing it if the mailbox uses the `drop_oldest`
+  /// policy and holds more messages than its capacity.
+  bool drop_oldest_on_overflow(mailbox_element& x);
+
+  /// Decrements `mailbox_size_hint_` after processing a message.
+  void dec_mailbox_size_hint() noexcept {
+    // Only this actor decrements the counter, i.e., it can't drop to zero
+    // between the check and the decrement.
+    if (mailbox_size_hint_.load(std::memory_order_relaxed) > 0)
+      mailbox_size_hint_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
   template <class F>
-  intrusive::task_result run_with_metrics(mailbox_element& x, F body) {
-    if (metrics_.mailbox_time) {
-      auto t0 = std::chrono::steady_clock::now();
+  intrusive::task_result run_with_metrics(mailbox_element& x, F fun) {
+    // Skipped messages remain in the mailbox.
+    auto body = [this, &fun] {
+      auto res = fun();
+      if (res != intrusive::task_result::skip)
+        dec_mailbox_size_hint();
+      return res;
+    };
+    if (metrics_.mailbox_size) {
+      if (!metrics_.sample()) {
+        auto res = body();
+        if (res != intrusive::task_result::skip)
+          metrics_.mailbox_size->dec();
+        return res;
+      }
+      auto t0 = metrics_.now();
       auto mbox_time = x.seconds_until(t0);
       auto res = body();
-      if (res != intrusive::task_result::skip) {
-        telemetry::timer::observe(metrics_.processing_time, t0);
-        metrics_.mailbox_time->observe(mbox_time);
-        metrics_.mailbox_size->dec();
-      }
+      if (res != intrusive::task_result::skip)
+        metrics_.message_processed(t0, mbox_time);
       return res;
     } else {
       return body();
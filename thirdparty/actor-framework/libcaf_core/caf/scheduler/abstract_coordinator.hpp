@@ -30,6 +30,7 @@
 #include "caf/detail/core_export.hpp"
 #include "caf/fwd.hpp"
 #include "caf/message.hpp"
+#include "caf/span.hpp"
 
 namespace caf::scheduler {
 
@@ -56,6 +57,10 @@ public:
   /// Puts `what` into the queue of a randomly chosen worker.
   virtual void enqueue(resumable* what) = 0;
 
+  /// Puts all `jobs` into the queues of the workers. The default
+  /// implementation calls `enqueue` for each job.
+  virtual void enqueue_all(span<resumable* const> jobs);
+
   actor_system& system() {
     return system_;
   }
@@ -148,6 +148,10 @@ protected:
     policy_.central_enqueue(this, ptr);
   }
 
+  void enqueue_all(span<resumable* const> jobs) override {
+    policy_.central_enqueue_all(this, jobs);
+  }
+
   detail::thread_safe_actor_clock& clock() noexcept override {
     return clock_;
   }
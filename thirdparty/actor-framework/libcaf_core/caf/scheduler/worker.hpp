@@ -46,7 +46,7 @@ public:
       id_(worker_id),
       parent_(worker_parent),
       data_(init) {
-    // nop
+    policy_.init_worker(this);
   }
 
   void start() {
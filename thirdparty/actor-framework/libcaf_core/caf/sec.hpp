@@ -162,6 +162,8 @@ enum class sec : uint8_t {
   conversion_failed,
   /// A network connection was closed by the remote side.
   connection_closed,
+  /// An actor rejected a request because its bounded mailbox was full.
+  mailbox_full,
 };
 
 /// @relates sec
@@ -18,10 +18,13 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "caf/actor.hpp"
 #include "caf/actor_addr.hpp"
 #include "caf/actor_cast.hpp"
 #include "caf/check_typed_input.hpp"
+#include "caf/detail/batched_execution_unit.hpp"
 #include "caf/is_message_sink.hpp"
 #include "caf/local_actor.hpp"
 #include "caf/mailbox_element.hpp"
@@ -33,6 +36,21 @@
 #include "caf/system_messages.hpp"
 #include "caf/typed_actor.hpp"
 
+namespace caf::detail {
+
+/// Returns `x` unchanged if the user passes a single `message` and otherwise
+/// wraps all arguments into a new `message`.
+template <class T, class... Ts>
+message make_multicast_payload(T&& x, Ts&&... xs) {
+  if constexpr (sizeof...(Ts) == 0
+                && std::is_same<std::decay_t<T>, message>::value)
+    return std::forward<T>(x);
+  else
+    return make_message(std::forward<T>(x), std::forward<Ts>(xs)...);
+}
+
+} // namespace caf::detail
+
 namespace caf {
 
 /// Sends `to` a message under the identity of `from` with priority `prio`.
@@ -102,6 +120,67 @@ void anon_send(const Dest& dest, Ts&&... xs) {
                   std::forward<Ts>(xs)...);
 }
 
+/// Anonymously sends the same message to all `receivers`. All mailbox
+/// elements share a single message payload and CAF hands all receivers that
+/// become ready for execution to the scheduler in a single batch.
+template <message_priority P = message_priority::normal, class Container,
+          class... Ts>
+void anon_multicast(const Container& receivers, Ts&&... xs) {
+  static_assert(sizeof...(Ts) > 0, "no message to send");
+  using dest_type = typename Container::value_type;
+  using token = detail::type_list<detail::strip_and_convert_t<Ts>...>;
+  static_assert(response_type_unbox<signatures_of_t<dest_type>, token>::valid,
+                "receiver does not accept given message");
+  auto is_valid = [](const dest_type& x) { return static_cast<bool>(x); };
+  auto first = std::find_if(receivers.begin(), receivers.end(), is_valid);
+  if (first == receivers.end())
+    return;
+  auto sys = &actor_cast<abstract_actor*>(*first)->home_system();
+  detail::batched_execution_unit host{sys};
+  host.reserve(receivers.size());
+  auto msg = detail::make_multicast_payload(std::forward<Ts>(xs)...);
+  for (auto i = first; i != receivers.end(); ++i)
+    if (*i)
+      actor_cast<abstract_actor*>(*i)->enqueue(
+        make_mailbox_element(nullptr, make_message_id(P), no_stages, msg),
+        &host);
+  host.flush();
+}
+
+/// Anonymously sends `dest` a message on the message lane `lane`.
+template <class Dest = actor, class... Ts>
+void anon_send_on_lane(uint8_t lane, const Dest& dest, Ts&&... xs) {
+  static_assert(sizeof...(Ts) > 0, "no message to send");
+  using token = detail::type_list<detail::strip_and_convert_t<Ts>...>;
+  static_assert(response_type_unbox<signatures_of_t<Dest>, token>::valid,
+                "receiver does not accept given message");
+  if (dest) {
+    auto element = make_mailbox_element(nullptr, make_message_id(), no_stages,
+                                        std::forward<Ts>(xs)...);
+    element->lane = lane;
+    dest->enqueue(std::move(element), nullptr);
+  }
+}
+
+/// Anonymously sends all messages in `xs` to `dest`. Actors with a mailbox
+/// publish all messages with a single atomic operation.
+template <message_priority P = message_priority::normal, class Dest = actor,
+          class Container>
+void anon_send_batch(const Dest& dest, const Container& xs) {
+  using token = detail::type_list<message>;
+  static_assert(response_type_unbox<signatures_of_t<Dest>, token>::valid,
+                "receiver does not accept given message");
+  if (dest && !xs.empty()) {
+    std::vector<mailbox_element_ptr> elements;
+    elements.reserve(xs.size());
+    for (auto& x : xs)
+      elements.emplace_back(
+        make_mailbox_element(nullptr, make_message_id(P), no_stages, x));
+    actor_cast<abstract_actor*>(dest)->enqueue_batch(std::move(elements),
+                                                     nullptr);
+  }
+}
+
 template <message_priority P = message_priority::normal, class Dest = actor,
           class Rep = int, class Period = std::ratio<1>, class... Ts>
 detail::enable_if_t<!std::is_same<Dest, group>::value>
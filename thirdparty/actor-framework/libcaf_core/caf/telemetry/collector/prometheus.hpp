@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <ctime>
 #include <unordered_map>
 #include <vector>
@@ -30,6 +31,12 @@ namespace caf::telemetry::collector {
 
 /// Collects system metrics and exports them to the text-based Prometheus
 /// format. For a documentation of the format, see: https://git.io/fjgDD.
+///
+/// The collector caches the rendered names and labels of all lines between
+/// calls to `collect_from` and only re-renders values that changed since the
+/// previous run. The cache relies on the registry visiting metrics in the same
+/// order on each run and re-renders the affected lines whenever this order
+/// changes, e.g., after adding new metrics to the registry.
 class CAF_CORE_EXPORT prometheus {
 public:
   // -- member types -----------------------------------------------------------
@@ -39,6 +46,27 @@ public:
   /// have to maintain a null-terminator.
   using char_buffer = std::vector<char>;
 
+  /// Caches the text for a single line of the output.
+  struct line {
+    /// Points to the metric that generated this line.
+    const metric* instance = nullptr;
+
+    /// Stores the position of this line in the output of `instance`.
+    size_t index = 0;
+
+    /// Stores name and labels, followed by the last rendered value.
+    char_buffer text;
+
+    /// Stores the size of name and labels in `text`.
+    size_t prefix_size = 0;
+
+    /// Stores the bit pattern of the last rendered value.
+    uint64_t value_bits = 0;
+
+    /// Stores whether `text` contains a rendered value.
+    bool has_value = false;
+  };
+
   // -- properties -------------------------------------------------------------
 
   /// Returns the minimum scrape interval, i.e., the minimum time that needs to
@@ -87,6 +115,15 @@ public:
   void operator()(const metric_family* family, const metric* instance,
                   const int_histogram* val);
 
+  void operator()(const metric_family* family, const metric* instance,
+                  const sharded_int_counter* counter);
+
+  void operator()(const metric_family* family, const metric* instance,
+                  const sharded_int_gauge* gauge);
+
+  void operator()(const metric_family* family, const metric* instance,
+                  const hdr_histogram* val);
+
 private:
   /// Sets `current_family_` if not pointing to `family` already. When setting
   /// the member variable, also writes meta information to `buf_`.
@@ -97,18 +134,39 @@ private:
   void append_histogram(const metric_family* family, const metric* instance,
                         const histogram<ValueType>* val);
 
+  /// Returns the first of `num_lines` cached lines for `instance`. Calls
+  /// `make_prefixes` on a cache miss to render name and labels for each line.
+  template <class F>
+  line* lines_for(const metric* instance, size_t num_lines, F make_prefixes);
+
+  /// Returns the cached line for a metric that generates a single line.
+  line* single_line(const metric_family* family, const metric* instance);
+
+  /// Appends `x` to the output after updating its value to `value`.
+  void append_line(line& x, int64_t value);
+
+  /// @copydoc append_line
+  void append_line(line& x, double value);
+
   /// Stores the generated text output.
   char_buffer buf_;
 
+  /// Caches the rendered lines in the order of the previous run.
+  std::vector<line> lines_;
+
+  /// Points to the next line in `lines_` while collecting metrics.
+  size_t cursor_ = 0;
+
+  /// Stores the rendered timestamp for the current run, including the leading
+  /// whitespace and the trailing newline.
+  char_buffer timestamp_;
+
   /// Current timestamp.
   time_t now_ = 0;
 
   /// Caches type information and help text for a metric.
   std::unordered_map<const metric_family*, char_buffer> meta_info_;
 
-  /// Caches type information and help text for a metric.
-  std::unordered_map<const metric*, std::vector<char_buffer>> virtual_metrics_;
-
   /// Caches which metric family is currently collected.
   const metric_family* current_family_ = nullptr;
 
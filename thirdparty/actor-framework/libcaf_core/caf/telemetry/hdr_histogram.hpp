@@ -0,0 +1,172 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "caf/config.hpp"
+#include "caf/detail/core_export.hpp"
+#include "caf/detail/sharded_int.hpp"
+#include "caf/fwd.hpp"
+#include "caf/span.hpp"
+#include "caf/telemetry/label.hpp"
+#include "caf/telemetry/metric_type.hpp"
+
+namespace caf::telemetry {
+
+/// A high-dynamic-range histogram for non-negative floating point values such
+/// as latencies in seconds. Each power of two between `min_value()` and
+/// `max_value()` splits into `sub_buckets` linear buckets, which bounds the
+/// relative error of each bucket by `1 / sub_buckets`. Computing the bucket
+/// for a value only requires extracting bits from its IEEE 754
+/// representation. Further, each thread writes to its own shard, i.e.,
+/// observing values never contends with other threads unless more threads
+/// than shards exist.
+class CAF_CORE_EXPORT hdr_histogram {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using value_type = double;
+
+  using family_setting = unit_t;
+
+  // -- constants --------------------------------------------------------------
+
+  static constexpr metric_type runtime_type = metric_type::hdr_histogram;
+
+  /// Number of bits for selecting a linear bucket within a power of two.
+  static constexpr int sub_bucket_bits = 4;
+
+  /// Number of linear buckets per power of two.
+  static constexpr size_t sub_buckets = size_t{1} << sub_bucket_bits;
+
+  /// Exponent of the smallest tracked value (about 7.5ns for seconds).
+  static constexpr int min_exponent = -27;
+
+  /// Exponent of the first value past the tracked range (128s for seconds).
+  static constexpr int max_exponent = 7;
+
+  /// Total number of buckets, including one bucket for all values below
+  /// `min_value()` and one bucket for all values at or above `max_value()`.
+  static constexpr size_t num_buckets
+    = static_cast<size_t>(max_exponent - min_exponent) * sub_buckets + 2;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  hdr_histogram();
+
+  explicit hdr_histogram(span<const label>);
+
+  hdr_histogram(const hdr_histogram&) = delete;
+
+  hdr_histogram& operator=(const hdr_histogram&) = delete;
+
+  ~hdr_histogram();
+
+  // -- modifiers --------------------------------------------------------------
+
+  /// Increments the bucket where the observed value falls into, the number of
+  /// observed values and the sum of all observed values.
+  void observe(double value) noexcept {
+    auto& x = shards_[detail::sharded_int::shard_index() & mask_];
+    x.buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+    x.count.fetch_add(1, std::memory_order_relaxed);
+    // Shards are usually uncontended, so this loop rarely runs twice.
+    auto sum = x.sum.load(std::memory_order_relaxed);
+    while (!x.sum.compare_exchange_weak(sum, sum + value,
+                                        std::memory_order_relaxed))
+      ; // repeat
+  }
+
+  // -- observers --------------------------------------------------------------
+
+  /// Returns the number of observed values.
+  int64_t count() const noexcept;
+
+  /// Returns the sum of all observed values.
+  double sum() const noexcept;
+
+  /// Returns the number of observed values per bucket, summed up over all
+  /// shards.
+  std::vector<int64_t> bucket_counts() const;
+
+  /// Returns an upper bound for the value at quantile `q` (with `0 <= q <= 1`)
+  /// or 0 if the histogram has no observed values yet.
+  double quantile(double q) const {
+    auto counts = bucket_counts();
+    return quantile(counts, q);
+  }
+
+  // -- static utility functions -----------------------------------------------
+
+  /// Returns the smallest value with its own bucket.
+  static constexpr double min_value() noexcept {
+    return pow2(min_exponent);
+  }
+
+  /// Returns the smallest value that falls into the overflow bucket.
+  static constexpr double max_value() noexcept {
+    return pow2(max_exponent);
+  }
+
+  /// Returns the index of the bucket for `value`.
+  static size_t bucket_index(double value) noexcept {
+    static_assert(std::numeric_limits<double>::is_iec559);
+    // Also catches negative values and NaN.
+    if (!(value >= min_value()))
+      return 0;
+    if (value >= max_value())
+      return num_buckets - 1;
+    // For positive values, the biased exponent and the leading bits of the
+    // mantissa form a contiguous, monotonically increasing integer.
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(double));
+    constexpr uint64_t first = uint64_t{1023 + min_exponent} << sub_bucket_bits;
+    return static_cast<size_t>((bits >> (52 - sub_bucket_bits)) - first) + 1;
+  }
+
+  /// Returns the exclusive upper bound for values in bucket `index`.
+  static double upper_bound(size_t index) noexcept;
+
+  /// Returns an upper bound for the value at quantile `q` (with `0 <= q <= 1`)
+  /// based on `counts` as returned by `bucket_counts()`.
+  static double quantile(span<const int64_t> counts, double q) noexcept;
+
+private:
+  struct alignas(CAF_CACHE_LINE_SIZE) shard {
+    std::atomic<int64_t> count{0};
+    std::atomic<double> sum{0};
+    std::atomic<int64_t> buckets[num_buckets] = {};
+  };
+
+  static constexpr double pow2(int exp) noexcept {
+    return exp < 0 ? 1.0 / pow2(-exp) : (exp == 0 ? 1.0 : 2.0 * pow2(exp - 1));
+  }
+
+  std::unique_ptr<shard[]> shards_;
+
+  size_t mask_;
+};
+
+} // namespace caf::telemetry
@@ -31,8 +31,11 @@
 #include "caf/string_view.hpp"
 #include "caf/telemetry/counter.hpp"
 #include "caf/telemetry/gauge.hpp"
+#include "caf/telemetry/hdr_histogram.hpp"
 #include "caf/telemetry/histogram.hpp"
 #include "caf/telemetry/metric_family_impl.hpp"
+#include "caf/telemetry/sharded_int_counter.hpp"
+#include "caf/telemetry/sharded_int_gauge.hpp"
 
 namespace caf::telemetry {
 
@@ -324,6 +327,92 @@ public:
     return fptr->get_or_add({});
   }
 
+  /// Returns a sharded counter metric family. Sharded counters keep one cell
+  /// per thread and thus scale better than `int_counter` when many threads
+  /// update the same instance. Creates the family lazily if necessary, but
+  /// fails if the full name already belongs to a different family.
+  /// @param prefix The prefix (namespace) this family belongs to. Usually the
+  ///               application or protocol name, e.g., `http`. The prefix `caf`
+  ///               as well as prefixes starting with an underscore are
+  ///               reserved.
+  /// @param name The human-readable name of the metric, e.g., `requests`.
+  /// @param labels Names for all label dimensions of the metric.
+  /// @param helptext Short explanation of the metric.
+  /// @param unit Unit of measurement. Please use base units such as `bytes` or
+  ///             `seconds` (prefer lowercase). The pseudo-unit `1` identifies
+  ///             dimensionless counts.
+  /// @param is_sum Setting this to `true` indicates that this metric adds
+  ///               something up to a total, where only the total value is of
+  ///               interest. For example, the total number of HTTP requests.
+  sharded_int_counter_family*
+  sharded_counter_family(string_view prefix, string_view name,
+                         span_t<string_view> labels, string_view helptext,
+                         string_view unit = "1", bool is_sum = false) {
+    return family_impl<sharded_int_counter>(prefix, name, labels, helptext,
+                                            unit, is_sum);
+  }
+
+  /// @copydoc sharded_counter_family
+  sharded_int_counter_family*
+  sharded_counter_family(string_view prefix, string_view name,
+                         std::initializer_list<string_view> labels,
+                         string_view helptext, string_view unit = "1",
+                         bool is_sum = false) {
+    auto lbl_span = make_span(labels.begin(), labels.size());
+    return sharded_counter_family(prefix, name, lbl_span, helptext, unit,
+                                  is_sum);
+  }
+
+  /// Returns a sharded counter metric singleton, i.e., the single instance of
+  /// a family without label dimensions.
+  /// @copydetails sharded_counter_family
+  sharded_int_counter*
+  sharded_counter_singleton(string_view prefix, string_view name,
+                            string_view helptext, string_view unit = "1",
+                            bool is_sum = false) {
+    span_t<string_view> lbls;
+    auto fptr = sharded_counter_family(prefix, name, lbls, helptext, unit,
+                                       is_sum);
+    return fptr->get_or_add({});
+  }
+
+  /// Returns a sharded gauge metric family. Sharded gauges keep one cell per
+  /// thread and thus scale better than `int_gauge` when many threads update
+  /// the same instance. Creates the family lazily if necessary, but fails if
+  /// the full name already belongs to a different family.
+  /// @copydetails sharded_counter_family
+  sharded_int_gauge_family*
+  sharded_gauge_family(string_view prefix, string_view name,
+                       span_t<string_view> labels, string_view helptext,
+                       string_view unit = "1", bool is_sum = false) {
+    return family_impl<sharded_int_gauge>(prefix, name, labels, helptext, unit,
+                                          is_sum);
+  }
+
+  /// @copydoc sharded_gauge_family
+  sharded_int_gauge_family*
+  sharded_gauge_family(string_view prefix, string_view name,
+                       std::initializer_list<string_view> labels,
+                       string_view helptext, string_view unit = "1",
+                       bool is_sum = false) {
+    auto lbl_span = make_span(labels.begin(), labels.size());
+    return sharded_gauge_family(prefix, name, lbl_span, helptext, unit,
+                                is_sum);
+  }
+
+  /// Returns a sharded gauge metric singleton, i.e., the single instance of a
+  /// family without label dimensions.
+  /// @copydetails sharded_counter_family
+  sharded_int_gauge*
+  sharded_gauge_singleton(string_view prefix, string_view name,
+                          string_view helptext, string_view unit = "1",
+                          bool is_sum = false) {
+    span_t<string_view> lbls;
+    auto fptr = sharded_gauge_family(prefix, name, lbls, helptext, unit,
+                                     is_sum);
+    return fptr->get_or_add({});
+  }
+
   /// Returns a histogram metric family. Creates the family lazily if necessary,
   /// but fails if the full name already belongs to a different family.
   /// @param prefix The prefix (namespace) this family belongs to. Usually the
@@ -470,6 +559,44 @@ public:
     return fptr->get_or_add({});
   }
 
+  /// Returns an HDR histogram metric family. Unlike regular histograms, HDR
+  /// histograms need no bucket configuration, support quantile queries and
+  /// scale to many threads observing values concurrently. Creates the family
+  /// lazily if necessary, but fails if the full name already belongs to a
+  /// different family.
+  /// @copydetails sharded_counter_family
+  metric_family_impl<hdr_histogram>*
+  hdr_histogram_family(string_view prefix, string_view name,
+                       span_t<string_view> labels, string_view helptext,
+                       string_view unit = "1", bool is_sum = false) {
+    return family_impl<hdr_histogram>(prefix, name, labels, helptext, unit,
+                                      is_sum);
+  }
+
+  /// @copydoc hdr_histogram_family
+  metric_family_impl<hdr_histogram>*
+  hdr_histogram_family(string_view prefix, string_view name,
+                       std::initializer_list<string_view> labels,
+                       string_view helptext, string_view unit = "1",
+                       bool is_sum = false) {
+    auto lbl_span = make_span(labels.begin(), labels.size());
+    return hdr_histogram_family(prefix, name, lbl_span, helptext, unit,
+                                is_sum);
+  }
+
+  /// Returns an HDR histogram metric singleton, i.e., the single instance of a
+  /// family without label dimensions.
+  /// @copydetails sharded_counter_family
+  hdr_histogram* hdr_histogram_singleton(string_view prefix, string_view name,
+                                         string_view helptext,
+                                         string_view unit = "1",
+                                         bool is_sum = false) {
+    span_t<string_view> lbls;
+    auto fptr = hdr_histogram_family(prefix, name, lbls, helptext, unit,
+                                     is_sum);
+    return fptr->get_or_add({});
+  }
+
   /// @internal
   void config(const settings* ptr) {
     config_ = ptr;
@@ -489,6 +616,25 @@ private:
   /// @pre `families_mx_` is locked.
   metric_family* fetch(const string_view& prefix, const string_view& name);
 
+  template <class Type>
+  metric_family_impl<Type>*
+  family_impl(string_view prefix, string_view name, span_t<string_view> labels,
+              string_view helptext, string_view unit, bool is_sum) {
+    using family_type = metric_family_impl<Type>;
+    std::unique_lock<std::mutex> guard{families_mx_};
+    if (auto ptr = fetch(prefix, name)) {
+      assert_properties(ptr, Type::runtime_type, labels, unit, is_sum);
+      return static_cast<family_type*>(ptr);
+    }
+    auto ptr = std::make_unique<family_type>(to_string(prefix), to_string(name),
+                                             to_sorted_vec(labels),
+                                             to_string(helptext),
+                                             to_string(unit), is_sum);
+    auto result = ptr.get();
+    families_.emplace_back(std::move(ptr));
+    return result;
+  }
+
   static std::vector<std::string> to_sorted_vec(span_t<string_view> xs);
 
   static std::vector<std::string> to_sorted_vec(span_t<label_view> xs);
@@ -506,6 +652,12 @@ private:
         return f(static_cast<const metric_family_impl<int_gauge>*>(ptr));
       case metric_type::dbl_histogram:
         return f(static_cast<const metric_family_impl<dbl_histogram>*>(ptr));
+      case metric_type::sharded_int_counter:
+        return f(static_cast<const sharded_int_counter_family*>(ptr));
+      case metric_type::sharded_int_gauge:
+        return f(static_cast<const sharded_int_gauge_family*>(ptr));
+      case metric_type::hdr_histogram:
+        return f(static_cast<const metric_family_impl<hdr_histogram>*>(ptr));
       default:
         CAF_ASSERT(ptr->type() == metric_type::int_histogram);
         return f(static_cast<const metric_family_impl<int_histogram>*>(ptr));
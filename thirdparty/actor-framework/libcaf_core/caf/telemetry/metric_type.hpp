@@ -27,6 +27,9 @@ enum class metric_type : uint8_t {
   int_gauge,
   dbl_histogram,
   int_histogram,
+  sharded_int_counter,
+  sharded_int_gauge,
+  hdr_histogram,
 };
 
 } // namespace caf::telemetry
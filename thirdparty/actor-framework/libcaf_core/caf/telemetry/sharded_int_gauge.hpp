@@ -0,0 +1,93 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/detail/sharded_int.hpp"
+#include "caf/fwd.hpp"
+#include "caf/span.hpp"
+#include "caf/telemetry/label.hpp"
+#include "caf/telemetry/metric_type.hpp"
+
+namespace caf::telemetry {
+
+/// A gauge for integer values that many threads update concurrently. Stores
+/// one padded cell per thread and adds up all cells when reading the value.
+/// @note Unlike `int_gauge`, this gauge can neither return the new value on
+///       increment or decrement nor set its value directly.
+class CAF_CORE_EXPORT sharded_int_gauge {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using value_type = int64_t;
+
+  using family_setting = unit_t;
+
+  // -- constants --------------------------------------------------------------
+
+  static constexpr metric_type runtime_type = metric_type::sharded_int_gauge;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  sharded_int_gauge() = default;
+
+  explicit sharded_int_gauge(int64_t value) : value_(value) {
+    // nop
+  }
+
+  explicit sharded_int_gauge(span<const label>) {
+    // nop
+  }
+
+  // -- modifiers --------------------------------------------------------------
+
+  /// Increments the gauge by 1.
+  void inc() noexcept {
+    value_.add(1);
+  }
+
+  /// Increments the gauge by `amount`.
+  void inc(int64_t amount) noexcept {
+    value_.add(amount);
+  }
+
+  /// Decrements the gauge by 1.
+  void dec() noexcept {
+    value_.add(-1);
+  }
+
+  /// Decrements the gauge by `amount`.
+  void dec(int64_t amount) noexcept {
+    value_.add(-amount);
+  }
+
+  // -- observers --------------------------------------------------------------
+
+  /// Returns the current value of the gauge.
+  int64_t value() const noexcept {
+    return value_.sum();
+  }
+
+private:
+  detail::sharded_int value_;
+};
+
+} // namespace caf::telemetry
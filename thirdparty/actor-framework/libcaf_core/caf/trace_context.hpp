@@ -0,0 +1,118 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/fwd.hpp"
+#include "caf/string_view.hpp"
+
+namespace caf {
+
+/// A fixed-size tracing context that follows the W3C Trace Context format.
+/// Mailbox elements carry this context inline, i.e., propagating it never
+/// allocates. Default-constructed contexts are invalid and not sampled.
+struct CAF_CORE_EXPORT trace_context {
+  // -- constants --------------------------------------------------------------
+
+  /// Marks a context as sampled, i.e., actors record spans for it.
+  static constexpr uint8_t sampled_flag = 0x01;
+
+  // -- member variables -------------------------------------------------------
+
+  /// Stores the upper 64 bits of the 128-bit trace ID.
+  uint64_t trace_id_high = 0;
+
+  /// Stores the lower 64 bits of the 128-bit trace ID.
+  uint64_t trace_id_low = 0;
+
+  /// Identifies the span of the receiver.
+  uint64_t span_id = 0;
+
+  /// Identifies the span of the sender or 0 for root spans.
+  uint64_t parent_span_id = 0;
+
+  /// Stores the trace flags as defined by the W3C Trace Context format.
+  uint8_t flags = 0;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Queries whether this context belongs to a trace.
+  bool valid() const noexcept {
+    return (trace_id_high | trace_id_low) != 0 && span_id != 0;
+  }
+
+  /// Queries whether actors record spans for this context.
+  bool sampled() const noexcept {
+    return (flags & sampled_flag) != 0;
+  }
+
+  // -- factories --------------------------------------------------------------
+
+  /// Creates a new context for the root of a trace.
+  static trace_context make_root(uint8_t flags);
+
+  /// Creates the context for a message that the owner of this span sends. The
+  /// new context belongs to the same trace and uses this span as its parent.
+  trace_context make_child() const;
+
+  // -- conversion -------------------------------------------------------------
+
+  /// Renders the trace ID as 32 lowercase hex characters.
+  std::string trace_id_hex() const;
+
+  /// Renders this context as `traceparent` header value in the format
+  /// `00-<trace-id>-<span-id>-<flags>`.
+  std::string to_traceparent() const;
+
+  /// Parses the value of a `traceparent` header. The span ID of the header
+  /// becomes the parent of a new span.
+  static expected<trace_context> from_traceparent(string_view str);
+};
+
+/// Renders `x` as 16 lowercase hex characters.
+/// @relates trace_context
+CAF_CORE_EXPORT std::string to_hex_span_id(uint64_t x);
+
+/// @relates trace_context
+inline bool operator==(const trace_context& x, const trace_context& y) {
+  return x.trace_id_high == y.trace_id_high && x.trace_id_low == y.trace_id_low
+         && x.span_id == y.span_id && x.parent_span_id == y.parent_span_id
+         && x.flags == y.flags;
+}
+
+/// @relates trace_context
+inline bool operator!=(const trace_context& x, const trace_context& y) {
+  return !(x == y);
+}
+
+/// @relates trace_context
+template <class Inspector>
+bool inspect(Inspector& f, trace_context& x) {
+  return f.object(x).fields(f.field("trace_id_high", x.trace_id_high),
+                            f.field("trace_id_low", x.trace_id_low),
+                            f.field("span_id", x.span_id),
+                            f.field("parent_span_id", x.parent_span_id),
+                            f.field("flags", x.flags));
+}
+
+} // namespace caf
@@ -0,0 +1,195 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "caf/actor_profiler.hpp"
+#include "caf/detail/core_export.hpp"
+#include "caf/error.hpp"
+#include "caf/fwd.hpp"
+
+namespace caf {
+
+/// An actor profiler that records spawn, send, receive and processing events
+/// into a compact binary trace file. Each thread collects events into its own
+/// buffer and only grabs a lock when writing a full chunk to the file, so
+/// recording an event usually boils down to reading the clock and appending
+/// 32 bytes to a thread-local buffer.
+///
+/// The trace file starts with a 16-byte header (the magic string `CAFTRACE`,
+/// a 32-bit version number and the 32-bit record size), followed by fixed-size
+/// event records and a table with the names of all actors. Records use the
+/// byte order of the host. Use `convert_to_json` or the `caf-trace` tool to
+/// turn a trace into the Trace Event Format read by `chrome://tracing` and
+/// Perfetto.
+/// @experimental
+class CAF_CORE_EXPORT trace_profiler : public actor_profiler {
+public:
+  // -- member types -----------------------------------------------------------
+
+  /// Identifies the type of a trace record.
+  enum class event_kind : uint8_t {
+    /// The system spawned a new actor. The record stores the ID of the parent
+    /// (or 0) in `arg` and the name of the actor in `name_id`.
+    spawn,
+    /// The system is about to destroy an actor.
+    remove,
+    /// An actor started processing a mailbox element. The record stores the
+    /// address of the element in `arg`.
+    before_processing,
+    /// An actor finished processing a mailbox element. The record stores the
+    /// `invoke_message_result` in `result`.
+    after_processing,
+    /// An actor sent a mailbox element. The record stores the address of the
+    /// element in `arg`.
+    send,
+    /// An actor scheduled a mailbox element for delayed delivery. The record
+    /// stores the address of the element in `arg`.
+    send_scheduled,
+    /// Marks the end of the event records. The record stores the number of
+    /// entries in the name table that follows in `arg`.
+    end_of_records = 0xFF,
+  };
+
+  /// A single entry in the trace file.
+  struct record {
+    /// Nanoseconds on the steady clock.
+    uint64_t timestamp;
+
+    /// ID of the actor that caused the event.
+    uint64_t actor;
+
+    /// Event-specific argument.
+    uint64_t arg;
+
+    /// Identifies the thread that recorded the event.
+    uint32_t thread;
+
+    /// Identifies the name of a spawned actor.
+    uint16_t name_id;
+
+    /// Stores an `event_kind`.
+    uint8_t kind;
+
+    /// Stores an `invoke_message_result` for `after_processing` events.
+    uint8_t result;
+  };
+
+  static_assert(sizeof(record) == 32);
+
+  /// Stores per-thread records until writing them to the file.
+  struct thread_buffer;
+
+  // -- constants --------------------------------------------------------------
+
+  /// Version of the trace file format.
+  static constexpr uint32_t version = 1;
+
+  /// Number of records a thread collects before writing them to the file.
+  static constexpr size_t chunk_size = 1024;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  trace_profiler();
+
+  ~trace_profiler() override;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Opens `file_name` and starts recording. Until a successful call to `open`,
+  /// the profiler silently drops all events.
+  error open(const std::string& file_name);
+
+  /// Writes all pending records and the name table to the trace file and then
+  /// closes it. Called implicitly by the destructor.
+  void close();
+
+  /// Returns whether the profiler currently records events.
+  bool recording() const noexcept {
+    return recording_.load(std::memory_order_relaxed);
+  }
+
+  // -- conversion -------------------------------------------------------------
+
+  /// Reads a trace file from `in` and writes it to `out` as JSON in the Trace
+  /// Event Format. The output renders message processing as duration events
+  /// (annotated with the time the message spent in the mailbox), sent
+  /// messages as flow arrows and actor lifetimes as instant events.
+  static error convert_to_json(std::istream& in, std::ostream& out);
+
+  // -- overrides --------------------------------------------------------------
+
+  void add_actor(const local_actor& self, const local_actor* parent) override;
+
+  void remove_actor(const local_actor& self) override;
+
+  void before_processing(const local_actor& self,
+                         const mailbox_element& element) override;
+
+  void after_processing(const local_actor& self,
+                        invoke_message_result result) override;
+
+  void before_sending(const local_actor& self,
+                      mailbox_element& element) override;
+
+  void before_sending_scheduled(const local_actor& self,
+                                actor_clock::time_point timeout,
+                                mailbox_element& element) override;
+
+private:
+  void append(event_kind kind, uint64_t actor, uint64_t arg,
+              uint16_t name_id = 0, uint8_t result = 0);
+
+  thread_buffer& local_buffer();
+
+  void write(const record* first, size_t num_records);
+
+  /// Uniquely identifies this profiler in the thread-local buffer lists.
+  uint64_t id_;
+
+  /// Signals whether `file_` is open.
+  std::atomic<bool> recording_;
+
+  /// Guards `file_`.
+  std::mutex file_mtx_;
+
+  /// Points to the trace file while recording.
+  std::FILE* file_;
+
+  /// Guards `buffers_` and `names_`.
+  std::mutex mtx_;
+
+  /// Stores the buffers of all threads that recorded events.
+  std::vector<std::shared_ptr<thread_buffer>> buffers_;
+
+  /// Maps actor names to their ID in the name table.
+  std::unordered_map<std::string, uint16_t> names_;
+};
+
+} // namespace caf
@@ -0,0 +1,141 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/fwd.hpp"
+#include "caf/mailbox_element.hpp"
+#include "caf/timestamp.hpp"
+#include "caf/trace_context.hpp"
+
+namespace caf {
+
+/// Makes head-based sampling decisions for new traces and exports the spans
+/// of sampled messages as OTLP-compatible JSON. Each span covers the
+/// processing of a single message by a single actor.
+///
+/// The actor system only creates a tracer if `caf.tracing.sample-rate` is
+/// greater than 0. Actors still propagate trace contexts they receive from
+/// remote nodes when tracing is disabled locally, but they do not record spans
+/// in this case.
+class CAF_CORE_EXPORT tracer {
+public:
+  // -- member types -----------------------------------------------------------
+
+  /// Stores a finished span.
+  struct span {
+    trace_context context;
+    actor_id actor;
+    std::string name;
+    timestamp start;
+    timestamp end;
+  };
+
+  // -- constants --------------------------------------------------------------
+
+  /// Configures how many spans the tracer buffers before writing them.
+  static constexpr size_t batch_size = 512;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  /// Creates a tracer that starts a new trace for `sample_rate` of all root
+  /// messages and appends spans to `path`. An empty path disables the export,
+  /// e.g., when only propagating trace contexts to other nodes.
+  tracer(double sample_rate, std::string path, std::string service_name);
+
+  tracer(const tracer&) = delete;
+
+  tracer& operator=(const tracer&) = delete;
+
+  ~tracer();
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns the configured sample rate.
+  double sample_rate() const noexcept {
+    return sample_rate_;
+  }
+
+  /// Returns the number of spans recorded so far.
+  size_t recorded_spans() const noexcept;
+
+  // -- tracing ----------------------------------------------------------------
+
+  /// Initializes the trace context of `child`, which an actor sends while
+  /// processing `parent`. Messages of sampled traces always carry a context to
+  /// their receiver, while new traces only start if `tr` is not null and
+  /// selects the message for sampling.
+  static void propagate(tracer* tr, const mailbox_element* parent,
+                        mailbox_element& child) {
+    if (parent != nullptr && parent->trace.sampled())
+      child.trace = parent->trace.make_child();
+    else if (tr != nullptr)
+      tr->start_trace(child.trace);
+  }
+
+  /// Starts a new trace in `ctx` if the sampler selects it. Otherwise, leaves
+  /// `ctx` unchanged.
+  void start_trace(trace_context& ctx);
+
+  /// Records the span for an actor that processed a message with context `ctx`
+  /// from `start` until `end`.
+  void record(const local_actor& self, const trace_context& ctx,
+              timestamp start, timestamp end);
+
+  /// Writes all buffered spans to the output file.
+  void flush();
+
+private:
+  /// Writes `spans` as single line of JSON. Requires a lock on `file_mtx_`.
+  void write(const std::vector<span>& spans);
+
+  /// Stores the configured sample rate.
+  double sample_rate_;
+
+  /// Stores the threshold for sampling decisions. The tracer starts a new
+  /// trace whenever a random number falls below this threshold.
+  uint64_t threshold_;
+
+  /// Stores the service name for the OTLP resource.
+  std::string service_name_;
+
+  /// Guards `buf_` and `recorded_`.
+  mutable std::mutex mtx_;
+
+  /// Buffers spans until reaching `batch_size`.
+  std::vector<span> buf_;
+
+  /// Counts all recorded spans.
+  size_t recorded_ = 0;
+
+  /// Guards `file_`.
+  std::mutex file_mtx_;
+
+  /// Points to the output file or is null if the export is disabled.
+  FILE* file_ = nullptr;
+};
+
+} // namespace caf
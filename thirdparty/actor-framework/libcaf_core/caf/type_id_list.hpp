@@ -21,19 +21,34 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <string>
 
-#include "caf/detail/comparable.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/type_id.hpp"
 
+namespace caf::detail {
+
+/// Returns the canonical storage for the size-prefixed list `xs`. Stores a
+/// copy of `xs` in a global cache if no equal list exists yet.
+/// @relates type_id_list
+CAF_CORE_EXPORT const type_id_t* intern_type_id_list(const type_id_t* xs);
+
+} // namespace caf::detail
+
 namespace caf {
 
-/// A list of type IDs, stored in a size-prefix, contiguous memory block.
-class type_id_list : detail::comparable<type_id_list> {
+/// A list of type IDs, stored in a size-prefix, contiguous memory block. All
+/// lists created by ::make_type_id_list or ::type_id_list_builder point to
+/// interned storage, i.e., two lists are equal if and only if they point to
+/// the same memory block. The interned storage also holds a precomputed hash
+/// value in front of the size prefix.
+class type_id_list {
 public:
   using pointer = const type_id_t*;
 
+  /// @pre `data` points to interned storage, e.g., returned from
+  ///      `detail::intern_type_id_list`.
   constexpr explicit type_id_list(pointer data) noexcept : data_(data) {
     // nop
   }
@@ -67,8 +82,10 @@ public:
     return data_[index + 1];
   }
 
-  /// Compares this list to `other`.
+  /// Compares the content of this list to `other`.
   int compare(type_id_list other) const noexcept {
+    if (data_ == other.data_)
+      return 0;
     // These conversions are safe, because the size is stored in 16 bits.
     int s1 = data_[0];
     int s2 = other.data_[0];
@@ -78,6 +95,14 @@ public:
     return diff;
   }
 
+  /// Returns the precomputed hash value for this list.
+  size_t hash() const noexcept {
+    size_t result;
+    memcpy(&result, reinterpret_cast<const char*>(data_) - sizeof(size_t),
+           sizeof(size_t));
+    return result;
+  }
+
   /// Returns an iterator to the first type ID.
   pointer begin() const noexcept {
     return data_ + 1;
@@ -88,6 +113,32 @@ public:
     return begin() + size();
   }
 
+  // -- comparison operators ---------------------------------------------------
+
+  friend bool operator==(type_id_list x, type_id_list y) noexcept {
+    return x.data_ == y.data_;
+  }
+
+  friend bool operator!=(type_id_list x, type_id_list y) noexcept {
+    return x.data_ != y.data_;
+  }
+
+  friend bool operator<(type_id_list x, type_id_list y) noexcept {
+    return x.compare(y) < 0;
+  }
+
+  friend bool operator<=(type_id_list x, type_id_list y) noexcept {
+    return x.compare(y) <= 0;
+  }
+
+  friend bool operator>(type_id_list x, type_id_list y) noexcept {
+    return x.compare(y) > 0;
+  }
+
+  friend bool operator>=(type_id_list x, type_id_list y) noexcept {
+    return x.compare(y) >= 0;
+  }
+
 private:
   pointer data_;
 };
@@ -102,11 +153,24 @@ struct make_type_id_list_helper {
 /// Constructs a ::type_id_list from the template parameter pack `Ts`.
 /// @relates type_id_list
 template <class... Ts>
-constexpr type_id_list make_type_id_list() {
-  return type_id_list{make_type_id_list_helper<Ts...>::data};
+type_id_list make_type_id_list() {
+  static const auto result = type_id_list{
+    detail::intern_type_id_list(make_type_id_list_helper<Ts...>::data)};
+  return result;
 }
 
 /// @relates type_id_list
 CAF_CORE_EXPORT std::string to_string(type_id_list xs);
 
 } // namespace caf
+
+namespace std {
+
+template <>
+struct hash<caf::type_id_list> {
+  size_t operator()(caf::type_id_list x) const noexcept {
+    return x.hash();
+  }
+};
+
+} // namespace std
@@ -61,6 +61,12 @@ void abstract_actor::enqueue(strong_actor_ptr sender, message_id mid,
   enqueue(make_mailbox_element(sender, mid, {}, std::move(msg)), host);
 }
 
+void abstract_actor::enqueue_batch(std::vector<mailbox_element_ptr> xs,
+                                   execution_unit* host) {
+  for (auto& x : xs)
+    enqueue(std::move(x), host);
+}
+
 abstract_actor::abstract_actor(actor_config& cfg)
     : abstract_channel(cfg.flags) {
   // nop
@@ -91,6 +97,10 @@ mailbox_element* abstract_actor::peek_at_next_mailbox_element() {
   return nullptr;
 }
 
+size_t abstract_actor::mailbox_size_hint() const noexcept {
+  return 0;
+}
+
 void abstract_actor::register_at_system() {
   if (getf(is_registered_flag))
     return;
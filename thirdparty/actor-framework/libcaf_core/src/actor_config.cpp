@@ -26,7 +26,9 @@ actor_config::actor_config(execution_unit* host, local_actor* parent)
   : host(host),
     parent(parent),
     flags(abstract_channel::is_abstract_actor_flag),
-    groups(nullptr) {
+    groups(nullptr),
+    mailbox_capacity(0),
+    mailbox_overflow(mailbox_overflow_policy::drop_newest) {
   // nop
 }
 
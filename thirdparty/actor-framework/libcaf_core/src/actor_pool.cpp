@@ -18,16 +18,42 @@
 
 #include "caf/actor_pool.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <limits>
 #include <random>
 
 #include "caf/send.hpp"
 #include "caf/default_attachable.hpp"
+#include "caf/no_stages.hpp"
+#include "caf/scheduled_actor.hpp"
 
 #include "caf/detail/sync_request_bouncer.hpp"
 
 namespace caf {
 
+namespace {
+
+// Returns a random number in the range [0, n) from a thread-local generator,
+// i.e., without any synchronization between senders.
+size_t random_index(size_t n) {
+  thread_local std::minstd_rand engine{std::random_device{}()};
+  std::uniform_int_distribution<size_t> dis{0, n - 1};
+  return dis(engine);
+}
+
+// Scrambles the bits of `x` (finalizer of the SplitMix64 generator).
+uint64_t mix(uint64_t x) noexcept {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ull;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebull;
+  x ^= x >> 31;
+  return x;
+}
+
+} // namespace
+
 actor_pool::policy actor_pool::round_robin() {
   struct impl {
     impl() : pos_(0) {
@@ -36,12 +62,11 @@ actor_pool::policy actor_pool::round_robin() {
     impl(const impl&) : pos_(0) {
       // nop
     }
-    void operator()(actor_system&, uplock& guard, const actor_vec& vec,
+    void operator()(actor_system&, const actor_vec& vec,
                     mailbox_element_ptr& ptr, execution_unit* host) {
       CAF_ASSERT(!vec.empty());
-      actor selected = vec[pos_++ % vec.size()];
-      guard.unlock();
-      selected->enqueue(std::move(ptr), host);
+      auto pos = pos_.fetch_add(1, std::memory_order_relaxed);
+      vec[pos % vec.size()]->enqueue(std::move(ptr), host);
     }
     std::atomic<size_t> pos_;
   };
@@ -50,8 +75,7 @@ actor_pool::policy actor_pool::round_robin() {
 
 namespace {
 
-void broadcast_dispatch(actor_system&, actor_pool::uplock&,
-                        const actor_pool::actor_vec& vec,
+void broadcast_dispatch(actor_system&, const actor_pool::actor_vec& vec,
                         mailbox_element_ptr& ptr, execution_unit* host) {
   CAF_ASSERT(!vec.empty());
   auto msg = ptr->payload;
@@ -59,6 +83,33 @@ void broadcast_dispatch(actor_system&, actor_pool::uplock&,
     worker->enqueue(ptr->sender, ptr->mid, msg, host);
 }
 
+void random_dispatch(actor_system&, const actor_pool::actor_vec& vec,
+                     mailbox_element_ptr& ptr, execution_unit* host) {
+  CAF_ASSERT(!vec.empty());
+  vec[random_index(vec.size())]->enqueue(std::move(ptr), host);
+}
+
+void power_of_two_choices_dispatch(actor_system&,
+                                   const actor_pool::actor_vec& vec,
+                                   mailbox_element_ptr& ptr,
+                                   execution_unit* host) {
+  CAF_ASSERT(!vec.empty());
+  if (vec.size() == 1) {
+    vec.front()->enqueue(std::move(ptr), host);
+    return;
+  }
+  // Pick two distinct workers by drawing the second one from the n - 1 workers
+  // that remain after removing the first one.
+  auto i = random_index(vec.size());
+  auto j = random_index(vec.size() - 1);
+  if (j >= i)
+    ++j;
+  auto& x = vec[i];
+  auto& y = vec[j];
+  auto& selected = x->mailbox_size_hint() <= y->mailbox_size_hint() ? x : y;
+  selected->enqueue(std::move(ptr), host);
+}
+
 } // namespace
 
 actor_pool::policy actor_pool::broadcast() {
@@ -66,27 +117,64 @@ actor_pool::policy actor_pool::broadcast() {
 }
 
 actor_pool::policy actor_pool::random() {
+  return random_dispatch;
+}
+
+actor_pool::policy actor_pool::join_shortest_queue() {
   struct impl {
-    impl() : rd_() {
+    impl() : pos_(0) {
       // nop
     }
-    impl(const impl&) : rd_() {
+    impl(const impl&) : pos_(0) {
       // nop
     }
-    void operator()(actor_system&, uplock& guard, const actor_vec& vec,
+    void operator()(actor_system&, const actor_vec& vec,
                     mailbox_element_ptr& ptr, execution_unit* host) {
-      upgrade_to_unique_lock<detail::shared_spinlock> unique_guard{guard};
-      auto selected =
-          vec[dis_(rd_, decltype(dis_)::param_type(0, vec.size() - 1))];
-      unique_guard.unlock();
-      selected->enqueue(std::move(ptr), host);
+      CAF_ASSERT(!vec.empty());
+      // Start at a different offset for each message to spread messages evenly
+      // among workers with equal load.
+      auto n = vec.size();
+      auto offset = pos_.fetch_add(1, std::memory_order_relaxed) % n;
+      auto selected = offset;
+      auto min_size = std::numeric_limits<size_t>::max();
+      for (size_t i = 0; i < n && min_size > 0; ++i) {
+        auto index = (offset + i) % n;
+        if (auto size = vec[index]->mailbox_size_hint(); size < min_size) {
+          min_size = size;
+          selected = index;
+        }
+      }
+      vec[selected]->enqueue(std::move(ptr), host);
     }
-    std::random_device rd_;
-    std::uniform_int_distribution<size_t> dis_;
+    std::atomic<size_t> pos_;
   };
   return impl{};
 }
 
+actor_pool::policy actor_pool::power_of_two_choices() {
+  return power_of_two_choices_dispatch;
+}
+
+actor_pool::policy actor_pool::consistent_hashing(key_function f) {
+  // Uses rendezvous hashing: each message goes to the worker with the highest
+  // score for its key. Scores only depend on the key and the worker ID, hence
+  // changing the set of workers only affects keys of added or removed workers.
+  return [f{std::move(f)}](actor_system&, const actor_vec& vec,
+                           mailbox_element_ptr& ptr, execution_unit* host) {
+    CAF_ASSERT(!vec.empty());
+    auto key = mix(f(ptr->payload));
+    auto selected = vec.begin();
+    uint64_t max_score = 0;
+    for (auto i = vec.begin(); i != vec.end(); ++i) {
+      if (auto score = mix(key ^ (*i)->id()); score >= max_score) {
+        max_score = score;
+        selected = i;
+      }
+    }
+    (*selected)->enqueue(std::move(ptr), host);
+  };
+}
+
 actor_pool::~actor_pool() {
   // nop
 }
@@ -107,24 +195,42 @@ actor actor_pool::make(execution_unit* eu, size_t num_workers,
   auto res = make(eu, std::move(pol));
   auto ptr = static_cast<actor_pool*>(actor_cast<abstract_actor*>(res));
   auto res_addr = ptr->address();
+  actor_vec workers;
+  workers.reserve(num_workers);
   for (size_t i = 0; i < num_workers; ++i) {
     auto worker = fac();
     worker->attach(default_attachable::make_monitor(worker.address(), res_addr));
-    ptr->workers_.push_back(std::move(worker));
+    enable_mailbox_size_tracking(worker);
+    workers.push_back(std::move(worker));
   }
+  ptr->workers_ = std::make_shared<const actor_vec>(std::move(workers));
+  return res;
+}
+
+actor actor_pool::make(execution_unit* eu, const elastic_config& cfg,
+                       factory fac, policy pol) {
+  CAF_ASSERT(cfg.min_workers > 0);
+  CAF_ASSERT(cfg.min_workers <= cfg.max_workers);
+  auto res = make(eu, cfg.min_workers, fac, std::move(pol));
+  auto ptr = static_cast<actor_pool*>(actor_cast<abstract_actor*>(res));
+  ptr->factory_ = std::move(fac);
+  ptr->elastic_ = cfg;
+  ptr->last_busy_ = eu->system().clock().now();
+  ptr->schedule_tick();
   return res;
 }
 
 void actor_pool::enqueue(mailbox_element_ptr what, execution_unit* eu) {
-  upgrade_lock<detail::shared_spinlock> guard{workers_mtx_};
-  if (filter(guard, what->sender, what->mid, what->payload, eu))
+  auto xs = workers();
+  if (filter(*xs, what->sender, what->mid, what->payload, eu))
     return;
-  policy_(home_system(), guard, workers_, what, eu);
+  policy_(home_system(), *xs, what, eu);
 }
 
 actor_pool::actor_pool(actor_config& cfg)
-    : monitorable_actor(cfg),
-      planned_reason_(exit_reason::normal) {
+  : monitorable_actor(cfg),
+    workers_(std::make_shared<const actor_vec>()),
+    planned_reason_(exit_reason::normal) {
   register_at_system();
 }
 
@@ -143,21 +249,22 @@ void actor_pool::on_cleanup(const error& reason) {
   CAF_LOG_TERMINATE_EVENT(this, reason);
 }
 
-bool actor_pool::filter(upgrade_lock<detail::shared_spinlock>& guard,
+bool actor_pool::filter(const actor_vec& workers,
                         const strong_actor_ptr& sender, message_id mid,
                         message& content, execution_unit* eu) {
   CAF_LOG_TRACE(CAF_ARG(mid) << CAF_ARG(content));
   if (auto view = make_const_typed_message_view<exit_msg>(content)) {
-    // acquire second mutex as well
-    std::vector<actor> workers;
     auto reason = get<0>(view).reason;
     if (cleanup(std::move(reason), eu)) {
       // send exit messages *always* to all workers and clear vector afterwards
       // but first swap workers_ out of the critical section
-      upgrade_to_unique_lock<detail::shared_spinlock> unique_guard{guard};
-      workers_.swap(workers);
-      unique_guard.unlock();
-      for (auto& w : workers)
+      actor_vec_ptr xs;
+      { // Lifetime scope of guard.
+        std::unique_lock<std::mutex> guard{workers_mtx_};
+        xs = this->workers();
+        std::atomic_store(&workers_, std::make_shared<const actor_vec>());
+      }
+      for (auto& w : *xs)
         anon_send(w, content);
       unregister_from_system();
     }
@@ -166,15 +273,18 @@ bool actor_pool::filter(upgrade_lock<detail::shared_spinlock>& guard,
   if (auto view = make_const_typed_message_view<down_msg>(content)) {
     // remove failed worker from pool
     const auto& dm = get<0>(view);
-    upgrade_to_unique_lock<detail::shared_spinlock> unique_guard{guard};
-    auto last = workers_.end();
-    auto i = std::find(workers_.begin(), workers_.end(), dm.source);
-    CAF_LOG_DEBUG_IF(i == last, "received down message for an unknown worker");
-    if (i != last)
-      workers_.erase(i);
-    if (workers_.empty()) {
+    std::unique_lock<std::mutex> guard{workers_mtx_};
+    auto remaining = update_workers([&](actor_vec& xs) {
+      auto last = xs.end();
+      auto i = std::find(xs.begin(), last, dm.source);
+      CAF_LOG_DEBUG_IF(i == last,
+                       "received down message for an unknown worker");
+      if (i != last)
+        xs.erase(i);
+    });
+    if (remaining == 0) {
       planned_reason_ = exit_reason::out_of_workers;
-      unique_guard.unlock();
+      guard.unlock();
       quit(eu);
     }
     return true;
@@ -184,43 +294,53 @@ bool actor_pool::filter(upgrade_lock<detail::shared_spinlock>& guard,
     const auto& worker = get<2>(view);
     worker->attach(default_attachable::make_monitor(worker.address(),
                                                     address()));
-    upgrade_to_unique_lock<detail::shared_spinlock> unique_guard{guard};
-    workers_.push_back(worker);
+    enable_mailbox_size_tracking(worker);
+    std::unique_lock<std::mutex> guard{workers_mtx_};
+    update_workers([&](actor_vec& xs) { xs.push_back(worker); });
     return true;
   }
   if (auto view
       = make_const_typed_message_view<sys_atom, delete_atom, actor>(content)) {
-    upgrade_to_unique_lock<detail::shared_spinlock> unique_guard{guard};
     auto& what = get<2>(view);
-    auto last = workers_.end();
-    auto i = std::find(workers_.begin(), last, what);
-    if (i != last) {
-      default_attachable::observe_token tk{address(),
-                                           default_attachable::monitor};
-      what->detach(tk);
-      workers_.erase(i);
-    }
+    std::unique_lock<std::mutex> guard{workers_mtx_};
+    update_workers([&](actor_vec& xs) {
+      auto last = xs.end();
+      auto i = std::find(xs.begin(), last, what);
+      if (i != last) {
+        default_attachable::observe_token tk{address(),
+                                             default_attachable::monitor};
+        what->detach(tk);
+        xs.erase(i);
+      }
+    });
     return true;
   }
   if (content.match_elements<sys_atom, delete_atom>()) {
-    upgrade_to_unique_lock<detail::shared_spinlock> unique_guard{guard};
-    for (auto& worker : workers_) {
-      default_attachable::observe_token tk{address(),
-                                           default_attachable::monitor};
-      worker->detach(tk);
-    }
-    workers_.clear();
+    std::unique_lock<std::mutex> guard{workers_mtx_};
+    update_workers([&](actor_vec& xs) {
+      for (auto& worker : xs) {
+        default_attachable::observe_token tk{address(),
+                                             default_attachable::monitor};
+        worker->detach(tk);
+      }
+      xs.clear();
+    });
     return true;
   }
   if (content.match_elements<sys_atom, get_atom>()) {
-    auto cpy = workers_;
-    guard.unlock();
-    sender->enqueue(nullptr, mid.response_id(),
-                    make_message(std::move(cpy)), eu);
+    sender->enqueue(nullptr, mid.response_id(), make_message(workers), eu);
     return true;
   }
-  if (workers_.empty()) {
-    guard.unlock();
+  if (content.match_elements<sys_atom, tick_atom>()) {
+    // Stop scaling once the pool has shut down. Otherwise, the scheduled
+    // message would keep the pool alive.
+    if (factory_ && !getf(is_cleaned_up_flag)) {
+      scale();
+      schedule_tick();
+    }
+    return true;
+  }
+  if (workers.empty()) {
     if (mid.is_request() && sender != nullptr) {
       // Tell client we have ignored this request message by sending and empty
       // message back.
@@ -231,6 +351,75 @@ bool actor_pool::filter(upgrade_lock<detail::shared_spinlock>& guard,
   return false;
 }
 
+void actor_pool::enable_mailbox_size_tracking(const actor& worker) {
+  auto ptr = actor_cast<abstract_actor*>(worker);
+  if (auto self = dynamic_cast<scheduled_actor*>(ptr))
+    self->track_mailbox_size();
+}
+
+void actor_pool::scale() {
+  std::unique_lock<std::mutex> guard{workers_mtx_};
+  auto xs = workers();
+  auto num_workers = xs->size();
+  size_t backlog = 0;
+  for (auto& x : *xs)
+    backlog += x->mailbox_size_hint();
+  auto now = home_system().clock().now();
+  if (backlog > 0)
+    last_busy_ = now;
+  auto threshold = std::max(elastic_.backlog_threshold, size_t{1});
+  if (backlog > threshold * num_workers
+      && num_workers < elastic_.max_workers) {
+    // Add enough workers to bring the average backlog below the threshold.
+    auto wanted = std::min(backlog / threshold + 1, elastic_.max_workers);
+    CAF_LOG_DEBUG("grow elastic pool:" << CAF_ARG(backlog)
+                                       << CAF_ARG(num_workers)
+                                       << CAF_ARG(wanted));
+    auto res_addr = address();
+    update_workers([&](actor_vec& ys) {
+      while (ys.size() < wanted) {
+        auto worker = factory_();
+        worker->attach(default_attachable::make_monitor(worker.address(),
+                                                        res_addr));
+        enable_mailbox_size_tracking(worker);
+        ys.push_back(std::move(worker));
+      }
+    });
+  } else if (num_workers > elastic_.min_workers
+             && now - last_busy_ >= elastic_.idle_timeout) {
+    // Retire one worker per cool-down period. Only pick a worker with an
+    // empty mailbox to avoid dropping messages.
+    actor retired;
+    update_workers([&](actor_vec& ys) {
+      auto i = std::find_if(ys.rbegin(), ys.rend(), [](const actor& y) {
+        return y->mailbox_size_hint() == 0;
+      });
+      if (i != ys.rend()) {
+        retired = std::move(*i);
+        ys.erase(std::next(i).base());
+      }
+    });
+    if (retired) {
+      CAF_LOG_DEBUG("shrink elastic pool:" << CAF_ARG(num_workers));
+      default_attachable::observe_token tk{address(),
+                                           default_attachable::monitor};
+      retired->detach(tk);
+      last_busy_ = now;
+      guard.unlock();
+      anon_send_exit(retired, exit_reason::user_shutdown);
+    }
+  }
+}
+
+void actor_pool::schedule_tick() {
+  auto& clock = home_system().clock();
+  clock.schedule_message(clock.now() + elastic_.interval,
+                         strong_actor_ptr{ctrl()},
+                         make_mailbox_element(nullptr, make_message_id(),
+                                              no_stages, sys_atom_v,
+                                              tick_atom_v));
+}
+
 void actor_pool::quit(execution_unit* host) {
   // we can safely run our cleanup code here without holding
   // workers_mtx_ because abstract_actor has its own lock
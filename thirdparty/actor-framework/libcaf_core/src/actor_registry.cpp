@@ -98,6 +98,10 @@ size_t actor_registry::inc_running() {
   return ++*system_.base_metrics().running_actors;
 }
 
+void actor_registry::inc_running(size_t n) {
+  system_.base_metrics().running_actors->inc(static_cast<int64_t>(n));
+}
+
 size_t actor_registry::running() const {
   return static_cast<size_t>(system_.base_metrics().running_actors->value());
 }
@@ -24,6 +24,7 @@
 #include "caf/actor_system_config.hpp"
 #include "caf/defaults.hpp"
 #include "caf/detail/meta_object.hpp"
+#include "caf/detail/tsc_clock.hpp"
 #include "caf/event_based_actor.hpp"
 #include "caf/policy/work_sharing.hpp"
 #include "caf/policy/work_stealing.hpp"
@@ -32,6 +33,7 @@
 #include "caf/scheduler/coordinator.hpp"
 #include "caf/scheduler/test_coordinator.hpp"
 #include "caf/send.hpp"
+#include "caf/tracer.hpp"
 #include "caf/stateful_actor.hpp"
 
 namespace caf {
@@ -216,18 +218,20 @@ namespace {
 auto make_base_metrics(telemetry::metric_registry& reg) {
   return actor_system::base_metrics_t{
     // Initialize the base metrics.
-    reg.counter_singleton("caf.system", "rejected-messages",
-                          "Number of rejected messages.", "1", true),
-    reg.counter_singleton("caf.system", "processed-messages",
-                          "Number of processed messages.", "1", true),
+    reg.sharded_counter_singleton("caf.system", "rejected-messages",
+                                  "Number of rejected messages.", "1", true),
+    reg.sharded_counter_singleton("caf.system", "processed-messages",
+                                  "Number of processed messages.", "1", true),
     reg.gauge_singleton("caf.system", "running-actors",
                         "Number of currently running actors."),
-    reg.gauge_singleton("caf.system", "queued-messages",
-                        "Number of messages in all mailboxes.", "1", true),
+    reg.sharded_gauge_singleton("caf.system", "queued-messages",
+                                "Number of messages in all mailboxes.", "1",
+                                true),
   };
 }
 
-auto make_actor_metric_families(telemetry::metric_registry& reg) {
+auto make_actor_metric_families(telemetry::metric_registry& reg,
+                                bool use_hdr_histograms) {
   // Handling a single message generally should take microseconds. Going up to
   // several milliseconds usually indicates a problem (or blocking operations)
   // but may still be expected for very compute-intense tasks. Single messages
@@ -244,13 +248,32 @@ auto make_actor_metric_families(telemetry::metric_registry& reg) {
     1.,     // 1s
     5.,     // 5s
   }};
-  return actor_system::actor_metric_families_t{
-    reg.histogram_family<double>(
+  auto processing_time_help = "Time an actor needs to process messages.";
+  auto mailbox_time_help = "Time a message waits in the mailbox before "
+                           "processing.";
+  telemetry::dbl_histogram_family* processing_time = nullptr;
+  telemetry::dbl_histogram_family* mailbox_time = nullptr;
+  telemetry::hdr_histogram_family* hdr_processing_time = nullptr;
+  telemetry::hdr_histogram_family* hdr_mailbox_time = nullptr;
+  if (use_hdr_histograms) {
+    hdr_processing_time = reg.hdr_histogram_family(
+      "caf.actor", "processing-time", {"name"}, processing_time_help,
+      "seconds");
+    hdr_mailbox_time = reg.hdr_histogram_family(
+      "caf.actor", "mailbox-time", {"name"}, mailbox_time_help, "seconds");
+  } else {
+    processing_time = reg.histogram_family<double>(
       "caf.actor", "processing-time", {"name"}, default_buckets,
-      "Time an actor needs to process messages.", "seconds"),
-    reg.histogram_family<double>(
+      processing_time_help, "seconds");
+    mailbox_time = reg.histogram_family<double>(
       "caf.actor", "mailbox-time", {"name"}, default_buckets,
-      "Time a message waits in the mailbox before processing.", "seconds"),
+      mailbox_time_help, "seconds");
+  }
+  return actor_system::actor_metric_families_t{
+    processing_time,
+    mailbox_time,
+    hdr_processing_time,
+    hdr_mailbox_time,
     reg.gauge_family("caf.actor", "mailbox-size", {"name"},
                      "Number of messages in the mailbox."),
     {
@@ -297,8 +320,22 @@ actor_system::actor_system(actor_system_config& cfg)
   if (auto lst = get_if<string_list>(&cfg,
                                      "caf.metrics-filters.actors.excludes"))
     metrics_actors_excludes_ = std::move(*lst);
+  if (auto interval = get_or(cfg, "caf.metrics-filters.actors.sample-interval",
+                             size_t{1});
+      interval > 1)
+    metrics_actors_sample_interval_ = interval;
+  if (get_or(cfg, "caf.metrics-filters.actors.tsc-clock", false)) {
+    metrics_actors_tsc_clock_ = true;
+    // Calibrate the clock before spawning any actor.
+    static_cast<void>(detail::tsc_clock::now());
+  }
   if (!metrics_actors_includes_.empty())
-    actor_metric_families_ = make_actor_metric_families(metrics_);
+    actor_metric_families_ = make_actor_metric_families(
+      metrics_, get_or(cfg, "caf.metrics-filters.actors.hdr-histograms", false));
+  if (auto rate = get_or(cfg, "caf.tracing.sample-rate", 0.0); rate > 0.0)
+    tracer_ = std::make_unique<caf::tracer>(
+      rate, get_or(cfg, "caf.tracing.output", defaults::tracing::output),
+      get_or(cfg, "caf.tracing.service-name", defaults::tracing::service_name));
   // Spin up modules.
   for (auto& f : cfg.module_factories) {
     auto mod_ptr = f(*this);
@@ -476,6 +513,10 @@ actor_id actor_system::next_actor_id() {
   return ++ids_;
 }
 
+actor_id actor_system::next_actor_ids(size_t n) {
+  return ids_.fetch_add(n) + 1;
+}
+
 actor_id actor_system::latest_actor_id() const {
   return ids_.load();
 }
@@ -102,6 +102,13 @@ actor_system_config::actor_system_config()
                  "frequency of relaxed steal attempts")
     .add<timespan>("relaxed-sleep-duration",
                    "sleep duration between relaxed steal attempts");
+  opt_group{custom_options_, "caf.tracing"}
+    .add<double>("sample-rate", "fraction of new traces to record")
+    .add<string>("output", "output file for recorded spans (OTLP JSON)")
+    .add<string>("service-name", "service name for recorded spans");
+  opt_group{custom_options_, "caf.groups"} //
+    .add<size_t>("fan-out-threshold",
+                 "min. subscribers for delivering group messages in parallel");
   opt_group{custom_options_, "caf.logger"} //
     .add<bool>("inline-output", "disable logger thread (for testing only!)");
   opt_group{custom_options_, "caf.logger.file"}
@@ -72,7 +72,7 @@ void blocking_actor::enqueue(mailbox_element_ptr ptr, execution_unit*) {
   auto src = ptr->sender;
   auto collects_metrics = getf(abstract_actor::collects_metrics_flag);
   if (collects_metrics) {
-    ptr->set_enqueue_time();
+    ptr->set_enqueue_time(metrics_.now());
     metrics_.mailbox_size->inc();
   }
   // returns false if mailbox has been closed
@@ -225,9 +225,17 @@ blocking_actor::mailbox_visitor::operator()(mailbox_element& x) {
       });
     return visit(f, sres);
   };
+  // Record a span for messages that belong to a sampled trace.
+  auto traced_body = [this, &x, &body] {
+    auto start = make_timestamp();
+    auto result = body();
+    if (result != intrusive::task_result::skip)
+      self->record_span(x, start);
+    return result;
+  };
   // Post-process the returned value from the function body.
   if (!self->getf(abstract_actor::collects_metrics_flag)) {
-    auto result = body();
+    auto result = x.trace.sampled() ? traced_body() : body();
     if (result == intrusive::task_result::skip) {
       CAF_AFTER_PROCESSING(self, invoke_message_result::skipped);
       CAF_LOG_SKIP_EVENT();
@@ -237,16 +245,19 @@ blocking_actor::mailbox_visitor::operator()(mailbox_element& x) {
     }
     return result;
   } else {
-    auto t0 = std::chrono::steady_clock::now();
-    auto mbox_time = x.seconds_until(t0);
-    auto result = body();
+    auto& builtins = self->builtin_metrics();
+    auto sampled = builtins.sample();
+    using clock_type = local_actor::clock_type;
+    auto t0 = sampled ? builtins.now() : clock_type::time_point{};
+    auto mbox_time = sampled ? x.seconds_until(t0) : 0.;
+    auto result = x.trace.sampled() ? traced_body() : body();
     if (result == intrusive::task_result::skip) {
       CAF_AFTER_PROCESSING(self, invoke_message_result::skipped);
       CAF_LOG_SKIP_EVENT();
-      auto& builtins = self->builtin_metrics();
-      telemetry::timer::observe(builtins.processing_time, t0);
-      builtins.mailbox_time->observe(mbox_time);
-      builtins.mailbox_size->dec();
+      if (sampled)
+        builtins.message_processed(t0, mbox_time);
+      else
+        builtins.mailbox_size->dec();
     } else {
       CAF_AFTER_PROCESSING(self, invoke_message_result::consumed);
       CAF_LOG_FINALIZE_EVENT();
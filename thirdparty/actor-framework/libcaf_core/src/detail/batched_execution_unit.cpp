@@ -0,0 +1,46 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/detail/batched_execution_unit.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/scheduler/abstract_coordinator.hpp"
+#include "caf/span.hpp"
+
+namespace caf::detail {
+
+batched_execution_unit::~batched_execution_unit() {
+  CAF_ASSERT(jobs_.empty());
+}
+
+void batched_execution_unit::exec_later(resumable* ptr) {
+  jobs_.emplace_back(ptr);
+}
+
+void batched_execution_unit::reserve(size_t n) {
+  jobs_.reserve(n);
+}
+
+void batched_execution_unit::flush() {
+  if (!jobs_.empty()) {
+    system().scheduler().enqueue_all(make_span(jobs_));
+    jobs_.clear();
+  }
+}
+
+} // namespace caf::detail
@@ -0,0 +1,57 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#include "caf/detail/behavior_dispatch_table.hpp"
+
+#include <algorithm>
+
+namespace caf::detail {
+
+namespace {
+
+// Type ID lists are interned, so ordering by address is sufficient and avoids
+// comparing the content of the lists.
+bool less(const behavior_dispatch_table::entry& x,
+          const behavior_dispatch_table::entry& y) noexcept {
+  return x.types.data() < y.types.data();
+}
+
+} // namespace
+
+behavior_dispatch_table::behavior_dispatch_table(
+  span<const type_id_list> cases)
+  : num_cases_(cases.size()) {
+  entries_.reserve(cases.size());
+  for (size_t index = 0; index < cases.size(); ++index) {
+    auto shadowed = [&](const entry& x) { return x.types == cases[index]; };
+    if (std::none_of(entries_.begin(), entries_.end(), shadowed))
+      entries_.emplace_back(entry{cases[index], index});
+  }
+  std::sort(entries_.begin(), entries_.end(), less);
+}
+
+size_t behavior_dispatch_table::find(type_id_list types) const noexcept {
+  auto key = entry{types, num_cases_};
+  auto i = std::lower_bound(entries_.begin(), entries_.end(), key, less);
+  if (i != entries_.end() && i->types == types)
+    return i->index;
+  return num_cases_;
+}
+
+} // namespace caf::detail
@@ -0,0 +1,71 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/detail/sharded_int.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace caf::detail {
+
+namespace {
+
+// Upper bound for the number of cells per integer.
+constexpr size_t max_cells = 64;
+
+// Returns the smallest power of two that is greater than or equal to the
+// number of hardware threads, capped at `max_cells`.
+size_t cell_count() {
+  static const size_t result = [] {
+    size_t hw = std::max(std::thread::hardware_concurrency(), 1u);
+    size_t n = 1;
+    while (n < hw && n < max_cells)
+      n <<= 1;
+    return n;
+  }();
+  return result;
+}
+
+} // namespace
+
+sharded_int::sharded_int() : sharded_int(0) {
+  // nop
+}
+
+sharded_int::sharded_int(int64_t initial_value)
+  : cells_(new cell[cell_count()]), mask_(cell_count() - 1) {
+  cells_[0].value = initial_value;
+}
+
+sharded_int::~sharded_int() {
+  // nop
+}
+
+int64_t sharded_int::sum() const noexcept {
+  int64_t result = 0;
+  for (size_t i = 0; i <= mask_; ++i)
+    result += cells_[i].value.load(std::memory_order_relaxed);
+  return result;
+}
+
+size_t sharded_int::next_shard_index() noexcept {
+  static std::atomic<size_t> next;
+  return next++;
+}
+
+} // namespace caf::detail
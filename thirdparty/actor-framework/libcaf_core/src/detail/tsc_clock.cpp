@@ -0,0 +1,52 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/detail/tsc_clock.hpp"
+
+namespace caf::detail {
+
+namespace {
+
+// Minimum duration for sampling the time stamp counter against the steady
+// clock. Calibration only runs once, but blocks the calling thread.
+constexpr auto calibration_time = std::chrono::milliseconds(1);
+
+} // namespace
+
+const tsc_clock::calibration_data& tsc_clock::calibration() noexcept {
+  static const calibration_data result = [] {
+    calibration_data cal{0, base_clock::now(), 1.0};
+#ifdef CAF_HAS_TSC_CLOCK
+    auto tsc0 = __rdtsc();
+    auto t0 = base_clock::now();
+    auto t1 = t0;
+    do {
+      t1 = base_clock::now();
+    } while (t1 - t0 < calibration_time);
+    auto tsc1 = __rdtsc();
+    cal.tsc_base = tsc1;
+    cal.base = t1;
+    cal.rep_per_tick = static_cast<double>((t1 - t0).count())
+                       / static_cast<double>(tsc1 - tsc0);
+#endif
+    return cal;
+  }();
+  return result;
+}
+
+} // namespace caf::detail
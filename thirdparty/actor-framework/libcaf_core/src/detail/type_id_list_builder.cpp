@@ -20,70 +20,12 @@
 
 #include <cstdint>
 #include <cstdlib>
-#include <mutex>
-#include <unordered_set>
 
 #include "caf/config.hpp"
-#include "caf/hash/fnv.hpp"
 #include "caf/raise_error.hpp"
 #include "caf/type_id_list.hpp"
 
 namespace caf::detail {
-namespace {
-
-struct dyn_type_id_list {
-  explicit dyn_type_id_list(type_id_t* storage) noexcept : storage(storage) {
-    CAF_ASSERT(storage != nullptr);
-    auto first = reinterpret_cast<const byte*>(storage);
-    auto last = first + ((storage[0] + 1) * sizeof(type_id_t));
-    hash = caf::hash::fnv<size_t>::compute(make_span(first, last));
-  }
-
-  dyn_type_id_list(dyn_type_id_list&& other) noexcept
-    : storage(other.storage), hash(other.hash) {
-    other.storage = nullptr;
-    other.hash = 0;
-  }
-
-  ~dyn_type_id_list() {
-    free(storage);
-  }
-
-  type_id_t* storage;
-  size_t hash;
-};
-
-bool operator==(const dyn_type_id_list& x, const dyn_type_id_list& y) noexcept {
-  return type_id_list{x.storage} == type_id_list{y.storage};
-}
-
-} // namespace
-} // namespace caf::detail
-
-namespace std {
-template <>
-struct hash<caf::detail::dyn_type_id_list> {
-  size_t operator()(const caf::detail::dyn_type_id_list& x) const noexcept {
-    return x.hash;
-  }
-};
-} // namespace std
-
-namespace caf::detail {
-
-namespace {
-
-std::mutex type_id_list_cache_mx;
-std::unordered_set<dyn_type_id_list> type_id_list_cache;
-
-const type_id_t* get_or_set_type_id_buf(type_id_t* ptr) {
-  dyn_type_id_list dl{ptr};
-  std::unique_lock<std::mutex> guard{type_id_list_cache_mx};
-  auto iter = type_id_list_cache.emplace(std::move(dl)).first;
-  return iter->storage;
-}
-
-} // namespace
 
 type_id_list_builder::type_id_list_builder()
   : size_(0), reserved_(0), storage_(nullptr) {
@@ -132,25 +74,22 @@ type_id_list type_id_list_builder::move_to_list() noexcept {
   if (list_size == 0)
     return make_type_id_list();
   storage_[0] = static_cast<type_id_t>(list_size);
-  // Transfer ownership of buffer into the global cache. If an equivalent list
-  // already exists, get_or_set_type_id_buf releases `ptr` and returns the old
-  // buffer.
-  auto ptr = storage_;
+  // Look up the canonical list and release our buffer. The global cache keeps
+  // its own copy in case this list is new.
+  auto result = type_id_list{intern_type_id_list(storage_)};
+  free(storage_);
   storage_ = nullptr;
-  return type_id_list{get_or_set_type_id_buf(ptr)};
+  size_ = 0;
+  reserved_ = 0;
+  return result;
 }
 
 type_id_list type_id_list_builder::copy_to_list() const {
   auto list_size = size();
   if (list_size == 0)
     return make_type_id_list();
-  auto vptr = malloc(size_ * sizeof(type_id_t));
-  if (vptr == nullptr)
-    CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
-  auto copy = reinterpret_cast<type_id_t*>(vptr);
-  copy[0] = static_cast<type_id_t>(list_size);
-  memcpy(copy + 1, storage_ + 1, list_size * sizeof(type_id_t));
-  return type_id_list{get_or_set_type_id_buf(copy)};
+  storage_[0] = static_cast<type_id_t>(list_size);
+  return type_id_list{intern_type_id_list(storage_)};
 }
 
 } // namespace caf::detail
@@ -23,6 +23,7 @@
 #include "caf/locks.hpp"
 #include "caf/logger.hpp"
 #include "caf/mailbox_element.hpp"
+#include "caf/no_stages.hpp"
 #include "caf/send.hpp"
 
 namespace caf {
@@ -38,20 +39,26 @@ forwarding_actor_proxy::~forwarding_actor_proxy() {
 
 void forwarding_actor_proxy::forward_msg(strong_actor_ptr sender,
                                          message_id mid, message msg,
-                                         const forwarding_stack* fwd) {
+                                         const forwarding_stack* fwd,
+                                         const trace_context* trace) {
   CAF_LOG_TRACE(CAF_ARG(id())
                 << CAF_ARG(sender) << CAF_ARG(mid) << CAF_ARG(msg));
   if (msg.match_elements<exit_msg>())
     unlink_from(msg.get_as<exit_msg>(0).source);
   forwarding_stack tmp;
   shared_lock<detail::shared_spinlock> guard(broker_mtx_);
-  if (broker_)
-    broker_->enqueue(nullptr, make_message_id(),
-                     make_message(forward_atom_v, std::move(sender),
-                                  fwd != nullptr ? *fwd : tmp,
-                                  strong_actor_ptr{ctrl()}, mid,
-                                  std::move(msg)),
-                     nullptr);
+  if (broker_) {
+    auto ptr = make_mailbox_element(nullptr, make_message_id(), no_stages,
+                                    forward_atom_v, std::move(sender),
+                                    fwd != nullptr ? *fwd : tmp,
+                                    strong_actor_ptr{ctrl()}, mid,
+                                    std::move(msg));
+    // Pass the trace context on to the broker, which serializes it for the
+    // remote receiver.
+    if (trace != nullptr)
+      ptr->trace = *trace;
+    broker_->enqueue(std::move(ptr), nullptr);
+  }
 }
 
 void forwarding_actor_proxy::enqueue(mailbox_element_ptr what,
@@ -59,7 +66,7 @@ void forwarding_actor_proxy::enqueue(mailbox_element_ptr what,
   CAF_PUSH_AID(0);
   CAF_ASSERT(what);
   forward_msg(std::move(what->sender), what->mid, std::move(what->payload),
-              &what->stages);
+              &what->stages, &what->trace);
 }
 
 bool forwarding_actor_proxy::add_backlink(abstract_actor* x) {
@@ -16,19 +16,26 @@
  * http://www.boost.org/LICENSE_1_0.txt.                                      *
  ******************************************************************************/
 
+#include <algorithm>
 #include <condition_variable>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <sstream>
 #include <stdexcept>
 
 #include "caf/all.hpp"
+#include "caf/defaults.hpp"
 #include "caf/deserializer.hpp"
+#include "caf/detail/topic_trie.hpp"
 #include "caf/event_based_actor.hpp"
 #include "caf/group.hpp"
 #include "caf/group_manager.hpp"
 #include "caf/locks.hpp"
 #include "caf/message.hpp"
+#include "caf/ref_counted.hpp"
+#include "caf/resumable.hpp"
 #include "caf/sec.hpp"
 #include "caf/serializer.hpp"
 
@@ -43,6 +50,7 @@ using upgrade_to_unique_guard = upgrade_to_unique_lock<detail::shared_spinlock>;
 
 class local_dispatcher;
 class local_group_module;
+class topic_group_module;
 
 void await_all_locals_down(actor_system& sys, std::initializer_list<actor> xs) {
   CAF_LOG_TRACE("");
@@ -59,42 +67,180 @@ void await_all_locals_down(actor_system& sys, std::initializer_list<actor> xs) {
     self->wait_for(ys);
 }
 
+// -- subscriber snapshots -----------------------------------------------------
+
+/// Sorted list of subscribers. Once published, a list never changes.
+using subscriber_list = std::vector<strong_actor_ptr>;
+
+using subscriber_list_ptr = std::shared_ptr<const subscriber_list>;
+
+/// Immutable view of all subscribers of a local group. Subscribers are
+/// partitioned by their actor ID, so joining or leaving only copies a single
+/// partition and each fan-out lane always serves the same subscribers.
+struct subscriber_snapshot {
+  std::vector<subscriber_list_ptr> partitions;
+  size_t size = 0;
+  bool fan_out = false;
+};
+
+using subscriber_snapshot_ptr = std::shared_ptr<const subscriber_snapshot>;
+
+/// Compares subscribers by the address of their control block.
+struct subscriber_less {
+  bool operator()(const strong_actor_ptr& x,
+                  const actor_control_block* y) const noexcept {
+    return x.get() < y;
+  }
+};
+
+// -- fan-out lanes ------------------------------------------------------------
+
+/// Delivers group messages to one partition of the subscribers. Lanes run on
+/// the scheduler and process their tasks in FIFO order, so subscribers still
+/// receive messages in the order the group received them.
+class fan_out_lane : public ref_counted, public resumable {
+public:
+  fan_out_lane(actor_system& sys, size_t partition)
+    : sys_(sys), partition_(partition) {
+    // nop
+  }
+
+  void push(subscriber_snapshot_ptr subscribers, strong_actor_ptr sender,
+            message msg) {
+    std::unique_lock<std::mutex> guard{mtx_};
+    tasks_.emplace_back(
+      task{std::move(subscribers), std::move(sender), std::move(msg)});
+    if (!scheduled_) {
+      scheduled_ = true;
+      guard.unlock();
+      ref(); // Released by the scheduler after `resume` returns `done`.
+      sys_.scheduler().enqueue(this);
+    }
+  }
+
+  subtype_t subtype() const override {
+    return resumable::function_object;
+  }
+
+  resume_result resume(execution_unit* host, size_t max_throughput) override {
+    for (size_t handled = 0; handled < max_throughput; ++handled) {
+      task x;
+      { // Lifetime scope of guard.
+        std::unique_lock<std::mutex> guard{mtx_};
+        if (tasks_.empty()) {
+          scheduled_ = false;
+          return resumable::done;
+        }
+        x = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      for (auto& s : *x.subscribers->partitions[partition_])
+        s->enqueue(x.sender, make_message_id(), x.msg, host);
+    }
+    std::unique_lock<std::mutex> guard{mtx_};
+    if (tasks_.empty()) {
+      scheduled_ = false;
+      return resumable::done;
+    }
+    return resumable::resume_later;
+  }
+
+  void intrusive_ptr_add_ref_impl() override {
+    ref();
+  }
+
+  void intrusive_ptr_release_impl() override {
+    deref();
+  }
+
+private:
+  struct task {
+    subscriber_snapshot_ptr subscribers;
+    strong_actor_ptr sender;
+    message msg;
+  };
+
+  actor_system& sys_;
+  size_t partition_;
+  std::mutex mtx_;
+  std::deque<task> tasks_;
+  bool scheduled_ = false;
+};
+
+using fan_out_lane_ptr = intrusive_ptr<fan_out_lane>;
+
+// -- local groups -------------------------------------------------------------
+
 class local_group : public abstract_group {
 public:
   void send_all_subscribers(const strong_actor_ptr& sender, const message& msg,
                             execution_unit* host) {
     CAF_LOG_TRACE(CAF_ARG(sender) << CAF_ARG(msg));
-    shared_guard guard(mtx_);
-    for (auto& s : subscribers_)
-      s->enqueue(sender, make_message_id(), msg, host);
+    auto xs = subscribers();
+    if (xs->fan_out) {
+      for (auto& lane : lanes_)
+        lane->push(xs, sender, msg);
+      return;
+    }
+    for (auto& partition : xs->partitions)
+      for (auto& s : *partition)
+        s->enqueue(sender, make_message_id(), msg, host);
+  }
+
+  /// Returns the current set of subscribers. Readers never block writers and
+  /// vice versa, because writers publish a new snapshot instead of modifying
+  /// the current one.
+  subscriber_snapshot_ptr subscribers() const {
+    return std::atomic_load(&subscribers_);
+  }
+
+  /// Delivers `msg` to all local recipients of the group.
+  virtual void deliver(const strong_actor_ptr& sender, const message& msg,
+                       execution_unit* host) {
+    send_all_subscribers(sender, msg, host);
   }
 
   void enqueue(strong_actor_ptr sender, message_id, message msg,
                execution_unit* host) override {
     CAF_LOG_TRACE(CAF_ARG(sender) << CAF_ARG(msg));
-    send_all_subscribers(sender, msg, host);
+    deliver(sender, msg, host);
     dispatcher_->enqueue(sender, make_message_id(), msg, host);
   }
 
   std::pair<bool, size_t> add_subscriber(strong_actor_ptr who) {
     CAF_LOG_TRACE(CAF_ARG(who));
     if (!who)
-      return {false, subscribers_.size()};
-    exclusive_guard guard(mtx_);
-    auto res = subscribers_.emplace(std::move(who)).second;
-    return {res, subscribers_.size()};
+      return {false, subscribers()->size};
+    std::unique_lock<std::mutex> guard{write_mtx_};
+    auto old = subscribers();
+    auto index = who->id() % old->partitions.size();
+    auto& xs = *old->partitions[index];
+    auto i = std::lower_bound(xs.begin(), xs.end(), who.get(),
+                              subscriber_less{});
+    if (i != xs.end() && *i == who)
+      return {false, old->size};
+    auto ys = std::make_shared<subscriber_list>();
+    ys->reserve(xs.size() + 1);
+    ys->insert(ys->end(), xs.begin(), i);
+    ys->emplace_back(std::move(who));
+    ys->insert(ys->end(), i, xs.end());
+    return {true, publish(*old, index, std::move(ys), old->size + 1)};
   }
 
   std::pair<bool, size_t> erase_subscriber(const actor_control_block* who) {
     CAF_LOG_TRACE(""); // serializing who would cause a deadlock
-    exclusive_guard guard(mtx_);
-    auto e = subscribers_.end();
-    auto cmp = [&](const strong_actor_ptr& lhs) { return lhs.get() == who; };
-    auto i = std::find_if(subscribers_.begin(), e, cmp);
-    if (i == e)
-      return {false, subscribers_.size()};
-    subscribers_.erase(i);
-    return {true, subscribers_.size()};
+    std::unique_lock<std::mutex> guard{write_mtx_};
+    auto old = subscribers();
+    auto index = who->id() % old->partitions.size();
+    auto& xs = *old->partitions[index];
+    auto i = std::lower_bound(xs.begin(), xs.end(), who, subscriber_less{});
+    if (i == xs.end() || i->get() != who)
+      return {false, old->size};
+    auto ys = std::make_shared<subscriber_list>();
+    ys->reserve(xs.size() - 1);
+    ys->insert(ys->end(), xs.begin(), i);
+    ys->insert(ys->end(), i + 1, xs.end());
+    return {true, publish(*old, index, std::move(ys), old->size - 1)};
   }
 
   bool subscribe(strong_actor_ptr who) override {
@@ -118,12 +264,32 @@ public:
   ~local_group() override;
 
 protected:
-  detail::shared_spinlock mtx_;
-#if __cplusplus > 201103L
-  std::set<strong_actor_ptr, std::less<>> subscribers_;
-#else
-  std::set<strong_actor_ptr> subscribers_;
-#endif
+  /// Replaces the partition at `index` and publishes the new snapshot. Once a
+  /// group reaches the fan-out threshold, it keeps dispatching via its lanes
+  /// to make sure that no message overtakes messages still queued in a lane.
+  /// Requires the caller to hold `write_mtx_`.
+  size_t publish(const subscriber_snapshot& old, size_t index,
+                 subscriber_list_ptr partition, size_t size) {
+    auto xs = std::make_shared<subscriber_snapshot>(old);
+    xs->partitions[index] = std::move(partition);
+    xs->size = size;
+    xs->fan_out = old.fan_out || size >= fan_out_threshold_;
+    std::atomic_store(&subscribers_, subscriber_snapshot_ptr{std::move(xs)});
+    return size;
+  }
+
+  /// Serializes writers. Readers only access `subscribers_` atomically.
+  std::mutex write_mtx_;
+
+  /// Points to the current set of subscribers.
+  subscriber_snapshot_ptr subscribers_;
+
+  /// Configures at which size the group dispatches messages via `lanes_`.
+  size_t fan_out_threshold_;
+
+  /// Delivers messages to subscribers in parallel, one lane per partition.
+  std::vector<fan_out_lane_ptr> lanes_;
+
   actor dispatcher_;
 };
 
@@ -179,8 +345,7 @@ public:
             [=](forward_atom, const message& what) {
               CAF_LOG_TRACE(CAF_ARG(what));
               // local forwarding
-              group_->send_all_subscribers(current_element_->sender, what,
-                                           context());
+              group_->deliver(current_element_->sender, what, context());
               // forward to all acquaintances
               send_to_acquaintances(what);
             }};
@@ -310,8 +475,24 @@ behavior proxy_dispatcher::make_behavior() {
 
 class local_group_module : public group_module {
 public:
-  local_group_module(actor_system& sys) : group_module(sys, "local") {
+  local_group_module(actor_system& sys) : local_group_module(sys, "local") {
+    // nop
+  }
+
+  local_group_module(actor_system& sys, std::string mname)
+    : group_module(sys, std::move(mname)) {
     CAF_LOG_TRACE("");
+    fan_out_threshold_ = get_or(sys.config(), "caf.groups.fan-out-threshold",
+                                defaults::groups::fan_out_threshold);
+    num_partitions_ = std::max(sys.scheduler().num_workers(), size_t{1});
+  }
+
+  size_t fan_out_threshold() const noexcept {
+    return fan_out_threshold_;
+  }
+
+  size_t num_partitions() const noexcept {
+    return num_partitions_;
   }
 
   expected<group> get(const std::string& identifier) override {
@@ -320,8 +501,7 @@ public:
     auto i = instances_.find(identifier);
     if (i != instances_.end())
       return group{i->second};
-    auto tmp = make_counted<local_group>(*this, identifier, system().node(),
-                                         none);
+    auto tmp = make_group(identifier);
     upgrade_to_unique_guard uguard(guard);
     auto p = instances_.emplace(identifier, tmp);
     auto result = p.first->second;
@@ -368,7 +548,15 @@ public:
       kvp.second->stop();
   }
 
+protected:
+  /// Creates a new group instance for `identifier`.
+  virtual local_group_ptr make_group(const std::string& identifier) {
+    return make_counted<local_group>(*this, identifier, system().node(), none);
+  }
+
 private:
+  size_t fan_out_threshold_;
+  size_t num_partitions_;
   detail::shared_spinlock instances_mtx_;
   std::map<std::string, local_group_ptr> instances_;
   detail::shared_spinlock proxies_mtx_;
@@ -377,8 +565,19 @@ private:
 
 local_group::local_group(local_group_module& mod, std::string id, node_id nid,
                          optional<actor> lb)
-  : abstract_group(mod, std::move(id), std::move(nid)) {
+  : abstract_group(mod, std::move(id), std::move(nid)),
+    fan_out_threshold_(mod.fan_out_threshold()) {
   CAF_LOG_TRACE(CAF_ARG(id) << CAF_ARG(nid));
+  auto n = mod.num_partitions();
+  auto xs = std::make_shared<subscriber_snapshot>();
+  xs->partitions.reserve(n);
+  lanes_.reserve(n);
+  auto empty_list = std::make_shared<const subscriber_list>();
+  for (size_t index = 0; index < n; ++index) {
+    xs->partitions.emplace_back(empty_list);
+    lanes_.emplace_back(make_counted<fan_out_lane>(mod.system(), index));
+  }
+  subscribers_ = std::move(xs);
   dispatcher_ = lb ? *lb : mod.system().spawn<local_dispatcher, hidden>(this);
 }
 
@@ -386,6 +585,153 @@ local_group::~local_group() {
   // nop
 }
 
+// -- topic groups -------------------------------------------------------------
+
+class topic_group;
+
+using topic_group_ptr = intrusive_ptr<topic_group>;
+
+using topic_trie = detail::topic_trie<topic_group_ptr>;
+
+/// Caches all groups with a filter that matches the identifier of a group.
+struct topic_match_list {
+  size_t version = 0;
+  std::vector<topic_group_ptr> groups;
+};
+
+using topic_match_list_ptr = std::shared_ptr<const topic_match_list>;
+
+/// A group of the module "topic". The identifier of the group is either a
+/// topic such as `sensors/1/temp` or a filter such as `sensors/+/temp`. Sending
+/// to a topic delivers the message to all groups with a matching filter, while
+/// sending to a filter only reaches actors that joined this particular filter.
+class topic_group : public local_group {
+public:
+  topic_group(topic_group_module& mod, std::string id, node_id nid);
+
+  void deliver(const strong_actor_ptr& sender, const message& msg,
+               execution_unit* host) override;
+
+  void stop() override {
+    CAF_LOG_TRACE("");
+    std::atomic_store(&matches_, topic_match_list_ptr{});
+    local_group::stop();
+  }
+
+private:
+  topic_group_module& topic_module() const noexcept;
+
+  /// Returns all groups matching our topic, recomputing the cached list if the
+  /// module added groups since the last lookup.
+  topic_match_list_ptr matches();
+
+  /// Stores whether the identifier contains wildcards.
+  bool is_filter_;
+
+  /// Caches all groups matching our topic.
+  topic_match_list_ptr matches_;
+};
+
+/// Manages topic groups in a trie to allow subscribing to entire hierarchies
+/// of topics via wildcards.
+class topic_group_module : public local_group_module {
+public:
+  explicit topic_group_module(actor_system& sys)
+    : local_group_module(sys, "topic"), version_(0) {
+    // nop
+  }
+
+  expected<group> get(const std::string& identifier) override {
+    CAF_LOG_TRACE(CAF_ARG(identifier));
+    if (!topic_trie::valid_filter(identifier))
+      return make_error(sec::invalid_argument, "invalid topic filter",
+                        identifier);
+    auto result = local_group_module::get(identifier);
+    if (result) {
+      topic_group_ptr ptr{static_cast<topic_group*>(result->get())};
+      exclusive_guard guard{trie_mtx_};
+      if (trie_.insert(identifier, std::move(ptr)))
+        ++version_;
+    }
+    return result;
+  }
+
+  using local_group_module::get;
+
+  void stop() override {
+    CAF_LOG_TRACE("");
+    { // Lifetime scope of guard.
+      exclusive_guard guard{trie_mtx_};
+      trie_.clear();
+      ++version_;
+    }
+    local_group_module::stop();
+  }
+
+  /// Returns a version number that changes whenever the set of groups changes.
+  size_t version() const noexcept {
+    return version_.load();
+  }
+
+  /// Returns all groups with filters matching `topic`.
+  topic_match_list_ptr match(const std::string& topic) const {
+    auto result = std::make_shared<topic_match_list>();
+    shared_guard guard{trie_mtx_};
+    result->version = version_.load();
+    trie_.for_each_match(topic, [&](const topic_group_ptr& grp) {
+      result->groups.emplace_back(grp);
+    });
+    return result;
+  }
+
+protected:
+  local_group_ptr make_group(const std::string& identifier) override {
+    return make_counted<topic_group>(*this, identifier, system().node());
+  }
+
+private:
+  mutable detail::shared_spinlock trie_mtx_;
+  topic_trie trie_;
+  std::atomic<size_t> version_;
+};
+
+topic_group::topic_group(topic_group_module& mod, std::string id, node_id nid)
+  : local_group(mod, std::move(id), std::move(nid), none),
+    is_filter_(topic_trie::has_wildcards(identifier())) {
+  // nop
+}
+
+topic_group_module& topic_group::topic_module() const noexcept {
+  return static_cast<topic_group_module&>(module());
+}
+
+void topic_group::deliver(const strong_actor_ptr& sender, const message& msg,
+                          execution_unit* host) {
+  CAF_LOG_TRACE(CAF_ARG(sender) << CAF_ARG(msg));
+  if (is_filter_) {
+    send_all_subscribers(sender, msg, host);
+    return;
+  }
+  auto xs = matches();
+  for (auto& grp : xs->groups) {
+    grp->send_all_subscribers(sender, msg, host);
+    // Our own dispatcher receives the message separately, but other groups
+    // need to forward the message to their remote subscribers.
+    if (grp.get() != this)
+      grp->dispatcher_->enqueue(sender, make_message_id(), msg, host);
+  }
+}
+
+topic_match_list_ptr topic_group::matches() {
+  auto& mod = topic_module();
+  auto xs = std::atomic_load(&matches_);
+  if (xs && xs->version == mod.version())
+    return xs;
+  xs = mod.match(identifier());
+  std::atomic_store(&matches_, xs);
+  return xs;
+}
+
 std::atomic<size_t> s_ad_hoc_id;
 
 } // namespace
@@ -394,6 +740,7 @@ void group_manager::init(actor_system_config& cfg) {
   CAF_LOG_TRACE("");
   using ptr_type = std::unique_ptr<group_module>;
   mmap_.emplace("local", ptr_type{new local_group_module(system_)});
+  mmap_.emplace("topic", ptr_type{new topic_group_module(system_)});
   for (auto& fac : cfg.group_module_factories) {
     ptr_type ptr{fac()};
     std::string name = ptr->name();
@@ -33,6 +33,7 @@
 #include "caf/resumable.hpp"
 #include "caf/scheduler.hpp"
 #include "caf/sec.hpp"
+#include "caf/tracer.hpp"
 
 namespace caf {
 
@@ -57,11 +58,21 @@ local_actor::metrics_t make_instance_metrics(local_actor* self) {
   self->setf(abstract_actor::collects_metrics_flag);
   const auto& families = sys.actor_metric_families();
   string_view sv{name, strlen(name)};
-  return {
-    families.processing_time->get_or_add({{"name", sv}}),
-    families.mailbox_time->get_or_add({{"name", sv}}),
-    families.mailbox_size->get_or_add({{"name", sv}}),
-  };
+  local_actor::metrics_t result;
+  if (families.hdr_processing_time != nullptr) {
+    result.hdr_processing_time
+      = families.hdr_processing_time->get_or_add({{"name", sv}});
+    result.hdr_mailbox_time
+      = families.hdr_mailbox_time->get_or_add({{"name", sv}});
+  } else {
+    result.processing_time
+      = families.processing_time->get_or_add({{"name", sv}});
+    result.mailbox_time = families.mailbox_time->get_or_add({{"name", sv}});
+  }
+  result.mailbox_size = families.mailbox_size->get_or_add({{"name", sv}});
+  result.sample_interval = sys.metrics_actors_sample_interval();
+  result.use_tsc_clock = sys.metrics_actors_tsc_clock();
+  return result;
 }
 
 } // namespace
@@ -135,6 +146,11 @@ void local_actor::on_exit() {
   // nop
 }
 
+void local_actor::record_span(const mailbox_element& x, timestamp start) {
+  if (auto tr = home_system().tracer())
+    tr->record(*this, x.trace, start, make_timestamp());
+}
+
 message_id local_actor::new_request_id(message_priority mp) {
   auto result = ++last_request_id_;
   return mp == message_priority::normal ? result : result.with_high_priority();
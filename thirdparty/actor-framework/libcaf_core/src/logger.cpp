@@ -19,6 +19,7 @@
 #include "caf/logger.hpp"
 
 #include <algorithm>
+#include <array>
 #include <condition_variable>
 #include <cstring>
 #include <ctime>
@@ -54,6 +55,9 @@ thread_local actor_id current_actor_id;
 // Stores a pointer to the system-wide logger.
 thread_local intrusive_ptr<logger> current_logger_ptr;
 
+// Generates unique IDs for logger instances.
+std::atomic<size_t> next_logger_id;
+
 constexpr string_view log_level_name[] = {
   "QUIET",
   "",
@@ -265,11 +269,77 @@ actor_id logger::thread_local_aid(actor_id aid) {
   return aid;
 }
 
+// A circular buffer with a single producer and a single consumer.
+struct logger::thread_buffer {
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> rd_pos{0};
+
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> wr_pos{0};
+
+  std::array<event, queue_size> events;
+
+  static size_t next(size_t pos) noexcept {
+    return (pos + 1) % queue_size;
+  }
+};
+
+logger::thread_buffer& logger::local_buffer() {
+  // Each entry maps a logger ID to the buffer of this thread. Usually, threads
+  // only log to a single logger, but tests may run multiple systems.
+  using entry = std::pair<size_t, thread_buffer_ptr>;
+  thread_local std::vector<entry> cache;
+  for (auto& [id, buf] : cache)
+    if (id == id_)
+      return *buf;
+  // Drop buffers of loggers that no longer exist.
+  auto orphaned = [](const entry& x) { return x.second.use_count() == 1; };
+  cache.erase(std::remove_if(cache.begin(), cache.end(), orphaned),
+              cache.end());
+  auto buf = std::make_shared<thread_buffer>();
+  {
+    std::unique_lock<std::mutex> guard{buffers_mtx_};
+    buffers_.emplace_back(buf);
+  }
+  cache.emplace_back(id_, buf);
+  return *buf;
+}
+
+bool logger::drain(std::vector<event>& out) {
+  std::unique_lock<std::mutex> guard{buffers_mtx_};
+  for (auto& buf : buffers_) {
+    auto first = buf->rd_pos.load(std::memory_order_relaxed);
+    auto last = buf->wr_pos.load(std::memory_order_acquire);
+    for (auto i = first; i != last; i = thread_buffer::next(i))
+      out.emplace_back(std::move(buf->events[i]));
+    buf->rd_pos.store(last, std::memory_order_release);
+  }
+  // Release buffers of terminated threads once we have drained them.
+  auto orphaned = [](const thread_buffer_ptr& x) {
+    return x.use_count() == 1
+           && x->rd_pos.load(std::memory_order_relaxed)
+                == x->wr_pos.load(std::memory_order_acquire);
+  };
+  buffers_.erase(std::remove_if(buffers_.begin(), buffers_.end(), orphaned),
+                 buffers_.end());
+  return !out.empty();
+}
+
 void logger::log(event&& x) {
-  if (cfg_.inline_output)
+  if (cfg_.inline_output) {
     handle_event(x);
-  else
-    queue_.push_back(std::move(x));
+    return;
+  }
+  auto& buf = local_buffer();
+  auto pos = buf.wr_pos.load(std::memory_order_relaxed);
+  auto next = thread_buffer::next(pos);
+  while (next == buf.rd_pos.load(std::memory_order_acquire)) {
+    // Drop the event instead of blocking forever if no thread drains the
+    // buffer.
+    if (!running_.load(std::memory_order_relaxed))
+      return;
+    std::this_thread::yield();
+  }
+  buf.events[pos] = std::move(x);
+  buf.wr_pos.store(next, std::memory_order_release);
 }
 
 void logger::set_current_actor_system(actor_system* x) {
@@ -287,7 +357,8 @@ bool logger::accepts(unsigned level, string_view cname) {
                       [=](string_view name) { return name == cname; });
 }
 
-logger::logger(actor_system& sys) : system_(sys), t0_(make_timestamp()) {
+logger::logger(actor_system& sys)
+  : system_(sys), t0_(make_timestamp()), id_(++next_logger_id), running_(false) {
   // nop
 }
 
@@ -522,26 +593,43 @@ string_view logger::skip_path(string_view path) {
 }
 
 void logger::run() {
-  // Bail out without printing anything if the first event we receive is the
-  // shutdown (empty) event.
-  queue_.wait_nonempty();
-  if (queue_.front().message.empty())
-    return;
-  if (!open_file() && console_verbosity() == CAF_LOG_LEVEL_QUIET)
-    return;
-  log_first_line();
-  // Loop until receiving an empty message.
+  // We only open the output on the first event to skip printing anything when
+  // shutting down before receiving any event.
+  enum { pending, enabled, disabled } output = pending;
+  std::vector<event> events;
+  auto by_timestamp = [](const event& x, const event& y) {
+    return x.tstamp < y.tstamp;
+  };
   for (;;) {
-    // Handle current head of the queue.
-    auto& e = queue_.front();
-    if (e.message.empty()) {
-      log_last_line();
+    // Read the flag before draining to make sure we never miss any event that
+    // got logged before calling `stop`.
+    auto done = !running_.load();
+    if (drain(events)) {
+      if (output == pending) {
+        if (open_file() || console_verbosity() != CAF_LOG_LEVEL_QUIET) {
+          output = enabled;
+          log_first_line();
+        } else {
+          output = disabled;
+        }
+      }
+      if (output == enabled) {
+        // Each buffer is ordered, but buffers interleave with each other.
+        std::stable_sort(events.begin(), events.end(), by_timestamp);
+        for (auto& e : events)
+          handle_event(e);
+      }
+      events.clear();
+    } else if (!done) {
+      std::unique_lock<std::mutex> guard{buffers_mtx_};
+      buffers_cv_.wait_for(guard, poll_interval,
+                           [this] { return !running_.load(); });
+    }
+    if (done) {
+      if (output == enabled)
+        log_last_line();
       return;
     }
-    handle_event(e);
-    // Prepare next iteration.
-    queue_.pop_front();
-    queue_.wait_nonempty();
   }
 }
 
@@ -656,6 +744,7 @@ void logger::start() {
     open_file();
     log_first_line();
   } else {
+    running_ = true;
     thread_ = std::thread{[this] {
       detail::set_thread_name("caf.logger");
       this->system_.thread_started();
@@ -672,8 +761,11 @@ void logger::stop() {
   }
   if (!thread_.joinable())
     return;
-  // A default-constructed event causes the logger to shutdown.
-  queue_.push_back(event{});
+  {
+    std::unique_lock<std::mutex> guard{buffers_mtx_};
+    running_ = false;
+    buffers_cv_.notify_all();
+  }
   thread_.join();
 }
 
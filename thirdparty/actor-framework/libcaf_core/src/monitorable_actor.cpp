@@ -40,20 +40,24 @@ const char* monitorable_actor::name() const {
 void monitorable_actor::attach(attachable_ptr ptr) {
   CAF_LOG_TRACE("");
   CAF_ASSERT(ptr != nullptr);
-  error fail_state;
-  auto attached = exclusive_critical_section([&] {
-    if (getf(is_terminated_flag)) {
-      fail_state = fail_state_;
-      return false;
+  // Push the new element to the lock-free stack. The critical section of
+  // `cleanup` closes the stack before releasing the attachables, i.e., the
+  // new element either gets released by `cleanup` or we observe the tag.
+  auto eof = attachables_closed_tag();
+  auto e = pending_attachables_.load(std::memory_order_acquire);
+  while (e != eof) {
+    ptr->next.reset(e);
+    auto new_head = ptr.get();
+    if (pending_attachables_.compare_exchange_weak(e, new_head,
+                                                   std::memory_order_release,
+                                                   std::memory_order_acquire)) {
+      ptr.release();
+      return;
     }
-    attach_impl(ptr);
-    return true;
-  });
-  if (!attached) {
-    CAF_LOG_DEBUG(
-      "cannot attach functor to terminated actor: call immediately");
-    ptr->actor_exited(fail_state, nullptr);
+    ptr->next.release();
   }
+  CAF_LOG_DEBUG("cannot attach functor to terminated actor: call immediately");
+  ptr->actor_exited(fail_state(), nullptr);
 }
 
 size_t monitorable_actor::detach(const attachable::token& what) {
@@ -83,6 +87,9 @@ bool monitorable_actor::cleanup(error&& reason, execution_unit* host) {
       // local actors pass fail_state_ as first argument
       if (&fail_state_ != &reason)
         fail_state_ = std::move(reason);
+      drain_pending_attachables();
+      pending_attachables_.store(attachables_closed_tag(),
+                                 std::memory_order_release);
       attachables_head_.swap(head);
       flags(flags() | is_terminated_flag | is_cleaned_up_flag);
       on_cleanup(fail_state_);
@@ -125,10 +132,17 @@ void monitorable_actor::bounce(mailbox_element_ptr& what, const error& err) {
   rb(*what);
 }
 
-monitorable_actor::monitorable_actor(actor_config& cfg) : abstract_actor(cfg) {
+monitorable_actor::monitorable_actor(actor_config& cfg)
+  : abstract_actor(cfg), pending_attachables_(nullptr) {
   // nop
 }
 
+monitorable_actor::~monitorable_actor() {
+  auto e = pending_attachables_.load();
+  if (e != attachables_closed_tag())
+    delete e;
+}
+
 void monitorable_actor::add_link(abstract_actor* x) {
   // Add backlink on `x` first and add the local attachable only on success.
   CAF_LOG_TRACE(CAF_ARG(x));
@@ -192,9 +206,28 @@ error monitorable_actor::fail_state() const {
   return fail_state_;
 }
 
+void monitorable_actor::drain_pending_attachables() {
+  auto eof = attachables_closed_tag();
+  auto e = pending_attachables_.load(std::memory_order_acquire);
+  while (e != nullptr && e != eof) {
+    if (pending_attachables_.compare_exchange_weak(e, nullptr,
+                                                   std::memory_order_acquire)) {
+      // The stack has LIFO order, i.e., we simply prepend it to the list.
+      attachable_ptr head{e};
+      auto i = e;
+      while (i->next != nullptr)
+        i = i->next.get();
+      i->next.swap(attachables_head_);
+      attachables_head_.swap(head);
+      return;
+    }
+  }
+}
+
 size_t monitorable_actor::detach_impl(const attachable::token& what,
                                       bool stop_on_hit, bool dry_run) {
   CAF_LOG_TRACE(CAF_ARG(stop_on_hit) << CAF_ARG(dry_run));
+  drain_pending_attachables();
   size_t count = 0;
   auto i = &attachables_head_;
   while (*i != nullptr) {
@@ -22,6 +22,7 @@
 #include "caf/config_value.hpp"
 #include "caf/defaults.hpp"
 #include "caf/scheduler/abstract_coordinator.hpp"
+#include "caf/telemetry/metric_registry.hpp"
 
 #define CONFIG(str_name, var_name)                                             \
   get_or(p->config(), "work-stealing." str_name,                               \
@@ -50,6 +51,35 @@ work_stealing::worker_data::worker_data(scheduler::abstract_coordinator* p)
   // nop
 }
 
+work_stealing::worker_metrics
+work_stealing::make_worker_metrics(telemetry::metric_registry& reg,
+                                   size_t worker_id) {
+  auto id = std::to_string(worker_id);
+  std::initializer_list<string_view> dims{"worker"};
+  std::initializer_list<telemetry::label_view> lbl{{"worker", id}};
+  auto resumes = reg.counter_family("caf.scheduler", "resumes", dims,
+                                    "Number of jobs resumed by the worker.");
+  auto steals = reg.counter_family(
+    "caf.scheduler", "steals", dims,
+    "Number of jobs the worker stole from other workers.");
+  auto failed_steals = reg.counter_family(
+    "caf.scheduler", "failed-steals", dims,
+    "Number of steal attempts that found no job.");
+  auto migrated_jobs = reg.counter_family(
+    "caf.scheduler", "migrated-jobs", dims,
+    "Number of jobs other workers stole from the worker.");
+  auto parked_time = reg.counter_family<double>(
+    "caf.scheduler", "parked-time", dims,
+    "Time the worker spent sleeping while waiting for jobs.", "seconds", true);
+  auto queue_size = reg.gauge_family("caf.scheduler", "queue-size", dims,
+                                     "Number of jobs in the worker queue.");
+  return {
+    resumes->get_or_add(lbl),       steals->get_or_add(lbl),
+    failed_steals->get_or_add(lbl), migrated_jobs->get_or_add(lbl),
+    parked_time->get_or_add(lbl),   queue_size->get_or_add(lbl),
+  };
+}
+
 work_stealing::worker_data::worker_data(const worker_data& other)
   : rengine(std::random_device{}()),
     uniform(other.uniform),
@@ -18,6 +18,9 @@
 
 #include "caf/scheduled_actor.hpp"
 
+#include <chrono>
+#include <thread>
+
 #include "caf/actor_ostream.hpp"
 #include "caf/actor_system_config.hpp"
 #include "caf/config.hpp"
@@ -27,6 +30,7 @@
 #include "caf/detail/private_thread.hpp"
 #include "caf/detail/sync_request_bouncer.hpp"
 #include "caf/inbound_path.hpp"
+#include "caf/mailbox_element.hpp"
 #include "caf/scheduler/abstract_coordinator.hpp"
 
 using namespace std::string_literals;
@@ -131,7 +135,11 @@ scheduled_actor::scheduled_actor(actor_config& cfg)
     down_handler_(default_down_handler),
     node_down_handler_(default_node_down_handler),
     exit_handler_(default_exit_handler),
-    private_thread_(nullptr)
+    private_thread_(nullptr),
+    tracks_mailbox_size_(false),
+    mailbox_size_hint_(0),
+    mailbox_capacity_(0),
+    mailbox_overflow_(mailbox_overflow_policy::drop_newest)
 #ifdef CAF_ENABLE_EXCEPTIONS
     ,
     exception_handler_(default_exception_handler)
@@ -140,6 +148,10 @@ scheduled_actor::scheduled_actor(actor_config& cfg)
   auto& sys_cfg = home_system().config();
   max_batch_delay_ = get_or(sys_cfg, "caf.stream.max_batch_delay",
                             defaults::stream::max_batch_delay);
+  if (cfg.mailbox_capacity > 0)
+    set_mailbox_capacity(cfg.mailbox_capacity, cfg.mailbox_overflow);
+  // Start with a single lane for all asynchronous messages.
+  set_message_lanes({1});
 }
 
 scheduled_actor::~scheduled_actor() {
@@ -156,13 +168,18 @@ void scheduled_actor::enqueue(mailbox_element_ptr ptr, execution_unit* eu) {
   CAF_ASSERT(!getf(is_blocking_flag));
   CAF_LOG_TRACE(CAF_ARG(*ptr));
   CAF_LOG_SEND_EVENT(ptr);
+  if (mailbox_capacity_.load(std::memory_order_relaxed) > 0
+      && !admit_to_full_mailbox(*ptr, eu))
+    return;
   auto mid = ptr->mid;
   auto sender = ptr->sender;
   auto collects_metrics = getf(abstract_actor::collects_metrics_flag);
   if (collects_metrics) {
-    ptr->set_enqueue_time();
+    ptr->set_enqueue_time(metrics_.now());
     metrics_.mailbox_size->inc();
   }
+  if (tracks_mailbox_size_.load(std::memory_order_relaxed))
+    mailbox_size_hint_.fetch_add(1, std::memory_order_relaxed);
   switch (mailbox().push_back(std::move(ptr))) {
     case intrusive::inbox_result::unblocked_reader: {
       CAF_LOG_ACCEPT_EVENT(true);
@@ -196,6 +213,128 @@ void scheduled_actor::enqueue(mailbox_element_ptr ptr, execution_unit* eu) {
       break;
   }
 }
+void scheduled_actor::enqueue_batch(std::vector<mailbox_element_ptr> xs,
+                                    execution_unit* eu) {
+  CAF_ASSERT(!getf(is_blocking_flag));
+  CAF_LOG_TRACE(CAF_ARG2("size", xs.size()));
+  if (xs.empty())
+    return;
+  // Bounded mailboxes need to check the capacity for each message.
+  if (mailbox_capacity_.load(std::memory_order_relaxed) > 0) {
+    super::enqueue_batch(std::move(xs), eu);
+    return;
+  }
+  auto n = static_cast<int64_t>(xs.size());
+  auto collects_metrics = getf(abstract_actor::collects_metrics_flag);
+  if (collects_metrics) {
+    auto t0 = metrics_.now();
+    for (auto& x : xs)
+      x->set_enqueue_time(t0);
+    metrics_.mailbox_size->inc(n);
+  }
+  if (tracks_mailbox_size_.load(std::memory_order_relaxed))
+    mailbox_size_hint_.fetch_add(xs.size(), std::memory_order_relaxed);
+  switch (mailbox().push_back_all(xs)) {
+    case intrusive::inbox_result::unblocked_reader: {
+      CAF_LOG_ACCEPT_EVENT(true);
+      // add a reference count to this actor and re-schedule it
+      intrusive_ptr_add_ref(ctrl());
+      if (getf(is_detached_flag)) {
+        CAF_ASSERT(private_thread_ != nullptr);
+        private_thread_->resume();
+      } else {
+        if (eu != nullptr)
+          eu->exec_later(this);
+        else
+          home_system().scheduler().enqueue(this);
+      }
+      break;
+    }
+    case intrusive::inbox_result::queue_closed: {
+      // The mailbox did not take ownership of the elements.
+      CAF_LOG_REJECT_EVENT();
+      home_system().base_metrics().rejected_messages->inc(n);
+      if (collects_metrics)
+        metrics_.mailbox_size->dec(n);
+      detail::sync_request_bouncer f{exit_reason()};
+      for (auto& x : xs)
+        if (x->mid.is_request())
+          f(x->sender, x->mid);
+      break;
+    }
+    case intrusive::inbox_result::success:
+      // enqueued to a running actors' mailbox; nothing to do
+      CAF_LOG_ACCEPT_EVENT(false);
+      break;
+  }
+}
+
+namespace {
+
+// Bounded mailboxes never drop responses and system messages, because this
+// could leave the actor in an inconsistent state.
+bool is_subject_to_capacity(const mailbox_element& x) {
+  if (!x.mid.is_normal_message() || x.mid.is_response())
+    return false;
+  auto& content = x.content();
+  return !content.match_elements<exit_msg>()
+         && !content.match_elements<down_msg>()
+         && !content.match_elements<node_down_msg>()
+         && !content.match_elements<timeout_msg>();
+}
+
+} // namespace
+
+bool scheduled_actor::admit_to_full_mailbox(mailbox_element& x,
+                                            execution_unit* eu) {
+  auto capacity = mailbox_capacity_.load(std::memory_order_relaxed);
+  auto full = [this, capacity] {
+    return mailbox_size_hint_.load(std::memory_order_relaxed) >= capacity;
+  };
+  if (!full() || !is_subject_to_capacity(x))
+    return true;
+  switch (mailbox_overflow_.load(std::memory_order_relaxed)) {
+    case mailbox_overflow_policy::drop_oldest:
+      // The actor drops messages from the head of its mailbox instead.
+      return true;
+    case mailbox_overflow_policy::suspend: {
+      // Only blocking actors run in their own thread. Suspending any other
+      // sender could stall a scheduler worker or the actor clock.
+      auto src = actor_cast<abstract_actor*>(x.sender);
+      if (src != nullptr && src->getf(is_blocking_flag))
+        while (full() && !mailbox().closed())
+          std::this_thread::sleep_for(std::chrono::microseconds(100));
+      return true;
+    }
+    case mailbox_overflow_policy::reject:
+      if (x.sender && x.mid.is_request())
+        x.sender->enqueue(ctrl(), x.mid.response_id(),
+                          make_message(make_error(sec::mailbox_full)), eu);
+      break;
+    default:
+      break;
+  }
+  CAF_LOG_DEBUG("mailbox full, drop message:" << CAF_ARG(x));
+  home_system().base_metrics().rejected_messages->inc();
+  return false;
+}
+
+bool scheduled_actor::drop_oldest_on_overflow(mailbox_element& x) {
+  auto capacity = mailbox_capacity_.load(std::memory_order_relaxed);
+  if (capacity == 0
+      || mailbox_overflow_.load(std::memory_order_relaxed)
+           != mailbox_overflow_policy::drop_oldest
+      || mailbox_size_hint_.load(std::memory_order_relaxed) <= capacity
+      || !is_subject_to_capacity(x))
+    return false;
+  CAF_LOG_DEBUG("mailbox full, drop oldest message:" << CAF_ARG(x));
+  dec_mailbox_size_hint();
+  home_system().base_metrics().rejected_messages->inc();
+  if (metrics_.mailbox_size)
+    metrics_.mailbox_size->dec();
+  return true;
+}
+
 mailbox_element* scheduled_actor::peek_at_next_mailbox_element() {
   return mailbox().closed() || mailbox().blocked() ? nullptr : mailbox().peek();
 }
@@ -301,6 +440,8 @@ resumable::resume_result scheduled_actor::resume(execution_unit* ctx,
   };
   // Callback for handling urgent and normal messages.
   auto handle_async = [this, max_throughput, &consumed](mailbox_element& x) {
+    if (drop_oldest_on_overflow(x))
+      return intrusive::task_result::resume;
     return run_with_metrics(x, [this, max_throughput, &consumed, &x] {
       switch (reactivate(x)) {
         case activation_result::terminated:
@@ -315,6 +456,12 @@ resumable::resume_result scheduled_actor::resume(execution_unit* ctx,
       }
     });
   };
+  // Callback for handling normal messages on all lanes.
+  auto handle_lane = [&handle_async](policy::message_lanes::key_type,
+                                     policy::message_lanes::nested_queue_type&,
+                                     mailbox_element& x) {
+    return handle_async(x);
+  };
   // Callback for handling upstream messages (e.g., ACKs).
   auto handle_umsg = [this, max_throughput, &consumed](mailbox_element& x) {
     return run_with_metrics(x, [this, max_throughput, &consumed, &x] {
@@ -399,7 +546,7 @@ resumable::resume_result scheduled_actor::resume(execution_unit* ctx,
     static constexpr size_t quantum = 3;
     // Dispatch urgent and normal (asynchronous) messages.
     get_urgent_queue().new_round(quantum * 3, handle_async);
-    get_normal_queue().new_round(quantum, handle_async);
+    get_normal_queue().new_round(quantum, handle_lane);
     // Consume all upstream messages. They are lightweight by design and ACKs
     // come with new credit, allowing us to advance stream traffic.
     if (auto tts = get_upstream_queue().total_task_size(); tts > 0) {
@@ -464,6 +611,19 @@ proxy_registry* scheduled_actor::proxy_registry_ptr() {
 
 // -- state modifiers ----------------------------------------------------------
 
+void scheduled_actor::set_message_lanes(const std::vector<size_t>& weights) {
+  auto& lanes = get_normal_queue();
+  lanes.policy().set_weights(lanes.queues(), weights);
+}
+
+void scheduled_actor::set_mailbox_capacity(
+  size_t capacity, mailbox_overflow_policy policy) noexcept {
+  mailbox_overflow_.store(policy, std::memory_order_relaxed);
+  if (capacity > 0)
+    track_mailbox_size();
+  mailbox_capacity_.store(capacity, std::memory_order_relaxed);
+}
+
 void scheduled_actor::quit(error x) {
   CAF_LOG_TRACE(CAF_ARG(x));
   // Make sure repeated calls to quit don't do anything.
@@ -783,7 +943,15 @@ invoke_message_result scheduled_actor::consume(mailbox_element& x) {
     CAF_CRITICAL("invalid message type");
   };
   // Post-process the returned value from the function body.
-  auto result = body();
+  auto result = invoke_message_result::consumed;
+  if (x.trace.sampled()) {
+    auto start = make_timestamp();
+    result = body();
+    if (result != invoke_message_result::skipped)
+      record_span(x, start);
+  } else {
+    result = body();
+  }
   CAF_AFTER_PROCESSING(this, result);
   CAF_LOG_SKIP_OR_FINALIZE_EVENT(result);
   return result;
@@ -929,19 +1097,12 @@ bool scheduled_actor::finalize() {
 }
 
 void scheduled_actor::push_to_cache(mailbox_element_ptr ptr) {
-  using namespace intrusive;
-  auto& p = mailbox_.queue().policy();
-  auto& qs = mailbox_.queue().queues();
-  // TODO: use generic lambda to avoid code duplication when switching to C++14
-  if (p.id_of(*ptr) == normal_queue_index) {
-    auto& q = std::get<normal_queue_index>(qs);
-    q.inc_total_task_size(q.policy().task_size(*ptr));
-    q.cache().push_back(ptr.release());
-  } else {
-    auto& q = std::get<normal_queue_index>(qs);
-    q.inc_total_task_size(q.policy().task_size(*ptr));
-    q.cache().push_back(ptr.release());
-  }
+  auto& lanes = get_normal_queue();
+  auto i = lanes.queues().find(lanes.policy().id_of(*ptr));
+  CAF_ASSERT(i != lanes.queues().end());
+  auto& q = i->second;
+  q.inc_total_task_size(q.policy().task_size(*ptr));
+  q.cache().push_back(ptr.release());
 }
 
 scheduled_actor::urgent_queue& scheduled_actor::get_urgent_queue() {
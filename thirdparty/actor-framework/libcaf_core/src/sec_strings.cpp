@@ -141,6 +141,8 @@ std::string to_string(sec x) {
       return "conversion_failed";
     case sec::connection_closed:
       return "connection_closed";
+    case sec::mailbox_full:
+      return "mailbox_full";
   };
 }
 
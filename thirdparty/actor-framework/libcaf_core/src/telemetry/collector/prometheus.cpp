@@ -19,14 +19,18 @@
 #include "caf/telemetry/collector/prometheus.hpp"
 
 #include <cmath>
+#include <cstring>
 #include <ctime>
 #include <type_traits>
 
 #include "caf/telemetry/dbl_gauge.hpp"
+#include "caf/telemetry/hdr_histogram.hpp"
 #include "caf/telemetry/int_gauge.hpp"
 #include "caf/telemetry/metric.hpp"
 #include "caf/telemetry/metric_family.hpp"
 #include "caf/telemetry/metric_registry.hpp"
+#include "caf/telemetry/sharded_int_counter.hpp"
+#include "caf/telemetry/sharded_int_gauge.hpp"
 
 using namespace caf::literals;
 
@@ -191,7 +195,12 @@ string_view prometheus::collect_from(const metric_registry& registry,
     return {buf_.data(), buf_.size()};
   buf_.clear();
   now_ = now;
+  timestamp_.clear();
+  append(timestamp_, ' ', ms_timestamp{now_}, '\n');
+  cursor_ = 0;
   registry.collect(*this);
+  // Drop lines for metrics that we did not visit in this run.
+  lines_.resize(cursor_);
   current_family_ = nullptr;
   return {buf_.data(), buf_.size()};
 }
@@ -203,29 +212,25 @@ string_view prometheus::collect_from(const metric_registry& registry) {
 void prometheus::operator()(const metric_family* family, const metric* instance,
                             const dbl_counter* counter) {
   set_current_family(family, "counter");
-  append(buf_, family, instance, ' ', counter->value(), ' ', ms_timestamp{now_},
-         '\n');
+  append_line(*single_line(family, instance), counter->value());
 }
 
 void prometheus::operator()(const metric_family* family, const metric* instance,
                             const int_counter* counter) {
   set_current_family(family, "counter");
-  append(buf_, family, instance, ' ', counter->value(), ' ', ms_timestamp{now_},
-         '\n');
+  append_line(*single_line(family, instance), counter->value());
 }
 
 void prometheus::operator()(const metric_family* family, const metric* instance,
                             const dbl_gauge* gauge) {
   set_current_family(family, "gauge");
-  append(buf_, family, instance, ' ', gauge->value(), ' ', ms_timestamp{now_},
-         '\n');
+  append_line(*single_line(family, instance), gauge->value());
 }
 
 void prometheus::operator()(const metric_family* family, const metric* instance,
                             const int_gauge* gauge) {
   set_current_family(family, "gauge");
-  append(buf_, family, instance, ' ', gauge->value(), ' ', ms_timestamp{now_},
-         '\n');
+  append_line(*single_line(family, instance), gauge->value());
 }
 
 void prometheus::operator()(const metric_family* family, const metric* instance,
@@ -238,6 +243,55 @@ void prometheus::operator()(const metric_family* family, const metric* instance,
   append_histogram(family, instance, val);
 }
 
+void prometheus::operator()(const metric_family* family, const metric* instance,
+                            const sharded_int_counter* counter) {
+  set_current_family(family, "counter");
+  append_line(*single_line(family, instance), counter->value());
+}
+
+void prometheus::operator()(const metric_family* family, const metric* instance,
+                            const sharded_int_gauge* gauge) {
+  set_current_family(family, "gauge");
+  append_line(*single_line(family, instance), gauge->value());
+}
+
+void prometheus::operator()(const metric_family* family, const metric* instance,
+                            const hdr_histogram* val) {
+  // Prometheus has no native type for HDR histograms. Hence, we render them as
+  // summaries with a fixed set of quantiles.
+  static constexpr double quantiles[] = {.5, .99, .999};
+  static constexpr size_t num_quantiles = std::size(quantiles);
+  auto make_prefixes = [&] {
+    std::vector<char_buffer> result;
+    result.reserve(num_quantiles + 2);
+    auto labels = instance->labels();
+    labels.emplace_back("quantile", "");
+    for (auto q : quantiles) {
+      auto str = std::to_string(q);
+      str.erase(str.find_last_not_of('0') + 1);
+      labels.back().value(str);
+      result.emplace_back();
+      append(result.back(), family, labels, ' ');
+    }
+    labels.pop_back();
+    result.emplace_back();
+    append(result.back(), family, "_sum"_sv, labels, ' ');
+    result.emplace_back();
+    append(result.back(), family, "_count"_sv, labels, ' ');
+    return result;
+  };
+  set_current_family(family, "summary");
+  auto vm = lines_for(instance, num_quantiles + 2, make_prefixes);
+  auto counts = val->bucket_counts();
+  for (size_t index = 0; index < num_quantiles; ++index)
+    append_line(vm[index], hdr_histogram::quantile(counts, quantiles[index]));
+  int64_t count = 0;
+  for (auto n : counts)
+    count += n;
+  append_line(vm[num_quantiles], val->sum());
+  append_line(vm[num_quantiles + 1], count);
+}
+
 void prometheus::set_current_family(const metric_family* family,
                                     string_view prometheus_type) {
   if (current_family_ == family)
@@ -253,6 +307,72 @@ void prometheus::set_current_family(const metric_family* family,
   buf_.insert(buf_.end(), i->second.begin(), i->second.end());
 }
 
+template <class F>
+prometheus::line* prometheus::lines_for(const metric* instance,
+                                        size_t num_lines, F make_prefixes) {
+  auto first = cursor_;
+  cursor_ += num_lines;
+  if (lines_.size() < cursor_) {
+    lines_.resize(cursor_);
+  } else {
+    auto matches = [&](size_t index) {
+      const auto& x = lines_[first + index];
+      return x.instance == instance && x.index == index;
+    };
+    auto hit = true;
+    for (size_t index = 0; index < num_lines && hit; ++index)
+      hit = matches(index);
+    if (hit)
+      return lines_.data() + first;
+  }
+  // Cache miss: render names and labels for all lines of this metric.
+  auto prefixes = make_prefixes();
+  CAF_ASSERT(prefixes.size() == num_lines);
+  for (size_t index = 0; index < num_lines; ++index) {
+    auto& x = lines_[first + index];
+    x.instance = instance;
+    x.index = index;
+    x.text = std::move(prefixes[index]);
+    x.prefix_size = x.text.size();
+    x.has_value = false;
+  }
+  return lines_.data() + first;
+}
+
+prometheus::line* prometheus::single_line(const metric_family* family,
+                                          const metric* instance) {
+  return lines_for(instance, 1, [family, instance] {
+    std::vector<char_buffer> result;
+    result.emplace_back();
+    append(result.back(), family, instance, ' ');
+    return result;
+  });
+}
+
+void prometheus::append_line(line& x, int64_t value) {
+  auto bits = static_cast<uint64_t>(value);
+  if (!x.has_value || x.value_bits != bits) {
+    x.text.resize(x.prefix_size);
+    append(x.text, value);
+    x.value_bits = bits;
+    x.has_value = true;
+  }
+  append(buf_, x.text, timestamp_);
+}
+
+void prometheus::append_line(line& x, double value) {
+  uint64_t bits;
+  static_assert(sizeof(bits) == sizeof(value));
+  memcpy(&bits, &value, sizeof(bits));
+  if (!x.has_value || x.value_bits != bits) {
+    x.text.resize(x.prefix_size);
+    append(x.text, value);
+    x.value_bits = bits;
+    x.has_value = true;
+  }
+  append(buf_, x.text, timestamp_);
+}
+
 namespace {
 
 template <class ValueType>
@@ -291,23 +411,18 @@ template <class ValueType>
 void prometheus::append_histogram(const metric_family* family,
                                   const metric* instance,
                                   const histogram<ValueType>* val) {
-  auto i = virtual_metrics_.find(instance);
-  if (i == virtual_metrics_.end()) {
-    auto metrics = make_virtual_metrics(family, instance, val);
-    i = virtual_metrics_.emplace(instance, std::move(metrics)).first;
-  }
   set_current_family(family, "histogram");
-  auto& vm = i->second;
   auto buckets = val->buckets();
+  auto vm = lines_for(instance, buckets.size() + 2, [&] {
+    return make_virtual_metrics(family, instance, val);
+  });
   size_t index = 0;
-  for (; index < buckets.size() - 1; ++index) {
-    append(buf_, vm[index], buckets[index].count.value(), ' ',
-           ms_timestamp{now_}, '\n');
-  }
+  for (; index < buckets.size() - 1; ++index)
+    append_line(vm[index], buckets[index].count.value());
   auto count = buckets[index].count.value();
-  append(buf_, vm[index], count, ' ', ms_timestamp{now_}, '\n');
-  append(buf_, vm[++index], val->sum(), ' ', ms_timestamp{now_}, '\n');
-  append(buf_, vm[++index], count, ' ', ms_timestamp{now_}, '\n');
+  append_line(vm[index], count);
+  append_line(vm[++index], val->sum());
+  append_line(vm[++index], count);
 }
 
 } // namespace caf::telemetry::collector
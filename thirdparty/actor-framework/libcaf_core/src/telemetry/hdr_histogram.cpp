@@ -0,0 +1,110 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/telemetry/hdr_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace caf::telemetry {
+
+namespace {
+
+// Upper bound for the number of shards per histogram. Each shard holds all
+// buckets, so we keep this limit lower than for sharded integers.
+constexpr size_t max_shards = 8;
+
+// Returns the smallest power of two that is greater than or equal to the
+// number of hardware threads, capped at `max_shards`.
+size_t num_shards() {
+  static const size_t result = [] {
+    size_t hw = std::max(std::thread::hardware_concurrency(), 1u);
+    size_t n = 1;
+    while (n < hw && n < max_shards)
+      n <<= 1;
+    return n;
+  }();
+  return result;
+}
+
+} // namespace
+
+hdr_histogram::hdr_histogram()
+  : shards_(new shard[num_shards()]), mask_(num_shards() - 1) {
+  // nop
+}
+
+hdr_histogram::hdr_histogram(span<const label>) : hdr_histogram() {
+  // nop
+}
+
+hdr_histogram::~hdr_histogram() {
+  // nop
+}
+
+int64_t hdr_histogram::count() const noexcept {
+  int64_t result = 0;
+  for (size_t i = 0; i <= mask_; ++i)
+    result += shards_[i].count.load(std::memory_order_relaxed);
+  return result;
+}
+
+double hdr_histogram::sum() const noexcept {
+  double result = 0;
+  for (size_t i = 0; i <= mask_; ++i)
+    result += shards_[i].sum.load(std::memory_order_relaxed);
+  return result;
+}
+
+std::vector<int64_t> hdr_histogram::bucket_counts() const {
+  std::vector<int64_t> result(num_buckets);
+  for (size_t i = 0; i <= mask_; ++i)
+    for (size_t j = 0; j < num_buckets; ++j)
+      result[j] += shards_[i].buckets[j].load(std::memory_order_relaxed);
+  return result;
+}
+
+double hdr_histogram::upper_bound(size_t index) noexcept {
+  if (index == 0)
+    return min_value();
+  if (index >= num_buckets - 1)
+    return std::numeric_limits<double>::infinity();
+  auto exp = min_exponent + static_cast<int>((index - 1) / sub_buckets);
+  auto sub = static_cast<double>((index - 1) % sub_buckets + 1);
+  return std::ldexp(1.0 + sub / sub_buckets, exp);
+}
+
+double hdr_histogram::quantile(span<const int64_t> counts, double q) noexcept {
+  int64_t total = 0;
+  for (auto n : counts)
+    total += n;
+  if (total == 0)
+    return 0;
+  auto rank = static_cast<int64_t>(std::ceil(q * static_cast<double>(total)));
+  rank = std::clamp(rank, int64_t{1}, total);
+  int64_t seen = 0;
+  for (size_t index = 0; index < counts.size(); ++index) {
+    seen += counts[index];
+    if (seen >= rank)
+      return upper_bound(index);
+  }
+  return upper_bound(counts.size() - 1);
+}
+
+} // namespace caf::telemetry
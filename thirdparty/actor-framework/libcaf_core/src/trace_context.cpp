@@ -0,0 +1,132 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#include "caf/trace_context.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <random>
+#include <thread>
+
+#include "caf/expected.hpp"
+#include "caf/sec.hpp"
+
+namespace caf {
+
+namespace {
+
+// Generates random IDs without synchronization between threads.
+uint64_t next_id() {
+  // Seeds a SplitMix64 generator per thread.
+  thread_local uint64_t state = [] {
+    std::random_device rd;
+    auto hi = static_cast<uint64_t>(rd());
+    auto lo = static_cast<uint64_t>(rd());
+    auto tid = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    return ((hi << 32) | lo) ^ static_cast<uint64_t>(tid);
+  }();
+  uint64_t result;
+  do {
+    auto z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    result = z ^ (z >> 31);
+  } while (result == 0);
+  return result;
+}
+
+bool parse_hex(string_view str, uint64_t& result) {
+  result = 0;
+  for (auto c : str) {
+    result <<= 4;
+    if (c >= '0' && c <= '9')
+      result |= static_cast<uint64_t>(c - '0');
+    else if (c >= 'a' && c <= 'f')
+      result |= static_cast<uint64_t>(c - 'a' + 10);
+    else
+      return false;
+  }
+  return true;
+}
+
+} // namespace
+
+trace_context trace_context::make_root(uint8_t flags) {
+  trace_context result;
+  result.trace_id_high = next_id();
+  result.trace_id_low = next_id();
+  result.span_id = next_id();
+  result.flags = flags;
+  return result;
+}
+
+trace_context trace_context::make_child() const {
+  auto result = *this;
+  result.parent_span_id = span_id;
+  result.span_id = next_id();
+  return result;
+}
+
+std::string trace_context::trace_id_hex() const {
+  char buf[33];
+  snprintf(buf, sizeof(buf), "%016" PRIx64 "%016" PRIx64, trace_id_high,
+           trace_id_low);
+  return std::string{buf, 32};
+}
+
+std::string trace_context::to_traceparent() const {
+  char buf[56];
+  snprintf(buf, sizeof(buf), "00-%016" PRIx64 "%016" PRIx64 "-%016" PRIx64
+           "-%02x", trace_id_high, trace_id_low, span_id,
+           static_cast<unsigned>(flags));
+  return std::string{buf, 55};
+}
+
+expected<trace_context> trace_context::from_traceparent(string_view str) {
+  // Format: 00-<32 hex digits>-<16 hex digits>-<2 hex digits>
+  auto invalid = [&] {
+    return make_error(sec::invalid_argument, "invalid traceparent",
+                      std::string{str.begin(), str.end()});
+  };
+  if (str.size() != 55 || str[2] != '-' || str[35] != '-' || str[52] != '-')
+    return invalid();
+  uint64_t version = 0;
+  uint64_t flags = 0;
+  trace_context result;
+  if (!parse_hex(str.substr(0, 2), version) || version != 0
+      || !parse_hex(str.substr(3, 16), result.trace_id_high)
+      || !parse_hex(str.substr(19, 16), result.trace_id_low)
+      || !parse_hex(str.substr(36, 16), result.parent_span_id)
+      || !parse_hex(str.substr(53, 2), flags))
+    return invalid();
+  if ((result.trace_id_high | result.trace_id_low) == 0
+      || result.parent_span_id == 0)
+    return invalid();
+  result.span_id = next_id();
+  result.flags = static_cast<uint8_t>(flags);
+  return result;
+}
+
+std::string to_hex_span_id(uint64_t x) {
+  char buf[17];
+  snprintf(buf, sizeof(buf), "%016" PRIx64, x);
+  return std::string{buf, 16};
+}
+
+} // namespace caf
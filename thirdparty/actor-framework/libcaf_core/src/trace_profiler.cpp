@@ -0,0 +1,390 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#include "caf/trace_profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <set>
+
+#include "caf/invoke_message_result.hpp"
+#include "caf/local_actor.hpp"
+#include "caf/mailbox_element.hpp"
+#include "caf/sec.hpp"
+
+namespace caf {
+
+namespace {
+
+constexpr char magic[] = {'C', 'A', 'F', 'T', 'R', 'A', 'C', 'E'};
+
+constexpr uint16_t unknown_name = 0xFFFF;
+
+std::atomic<uint64_t> next_profiler_id;
+
+std::atomic<uint32_t> next_thread_index;
+
+uint32_t thread_index() {
+  thread_local uint32_t result = next_thread_index.fetch_add(1) + 1;
+  return result;
+}
+
+uint64_t now() {
+  auto t = std::chrono::steady_clock::now().time_since_epoch();
+  using ns = std::chrono::nanoseconds;
+  return static_cast<uint64_t>(std::chrono::duration_cast<ns>(t).count());
+}
+
+uint64_t address_of(const mailbox_element& element) {
+  return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&element));
+}
+
+} // namespace
+
+struct trace_profiler::thread_buffer {
+  explicit thread_buffer(uint64_t owner) : owner(owner), closed(false) {
+    records.reserve(chunk_size);
+  }
+
+  /// ID of the profiler that owns this buffer.
+  uint64_t owner;
+
+  /// Signals that the owner no longer accepts records from this buffer.
+  std::atomic<bool> closed;
+
+  /// Guards `records`. Only contended while the profiler closes the file.
+  std::mutex mtx;
+
+  /// Stores pending records.
+  std::vector<record> records;
+};
+
+// -- constructors, destructors, and assignment operators ----------------------
+
+trace_profiler::trace_profiler()
+  : id_(next_profiler_id.fetch_add(1)), recording_(false), file_(nullptr) {
+  // nop
+}
+
+trace_profiler::~trace_profiler() {
+  close();
+}
+
+// -- properties ---------------------------------------------------------------
+
+error trace_profiler::open(const std::string& file_name) {
+  close();
+  std::lock_guard<std::mutex> guard{file_mtx_};
+  file_ = std::fopen(file_name.c_str(), "wb");
+  if (file_ == nullptr)
+    return make_error(sec::cannot_open_file, file_name);
+  uint32_t header[] = {version, static_cast<uint32_t>(sizeof(record))};
+  std::fwrite(magic, 1, sizeof(magic), file_);
+  std::fwrite(header, sizeof(uint32_t), 2, file_);
+  recording_ = true;
+  return none;
+}
+
+void trace_profiler::close() {
+  if (!recording_.exchange(false))
+    return;
+  std::lock_guard<std::mutex> guard{mtx_};
+  for (auto& buf : buffers_) {
+    std::lock_guard<std::mutex> buf_guard{buf->mtx};
+    buf->closed = true;
+    write(buf->records.data(), buf->records.size());
+    buf->records.clear();
+  }
+  buffers_.clear();
+  std::vector<const std::string*> names;
+  names.resize(names_.size());
+  for (auto& kvp : names_)
+    names[kvp.second] = &kvp.first;
+  std::lock_guard<std::mutex> file_guard{file_mtx_};
+  record eor{0, 0, names.size(), 0, 0,
+             static_cast<uint8_t>(event_kind::end_of_records), 0};
+  std::fwrite(&eor, sizeof(record), 1, file_);
+  for (auto name : names) {
+    auto len = static_cast<uint16_t>(name->size());
+    std::fwrite(&len, sizeof(uint16_t), 1, file_);
+    std::fwrite(name->data(), 1, len, file_);
+  }
+  std::fclose(file_);
+  file_ = nullptr;
+  names_.clear();
+}
+
+// -- overrides ----------------------------------------------------------------
+
+void trace_profiler::add_actor(const local_actor& self,
+                               const local_actor* parent) {
+  if (!recording())
+    return;
+  auto name_id = unknown_name;
+  { // Lock scope.
+    std::lock_guard<std::mutex> guard{mtx_};
+    auto i = names_.find(self.name());
+    if (i != names_.end())
+      name_id = i->second;
+    else if (names_.size() < unknown_name)
+      name_id = names_.emplace(self.name(), static_cast<uint16_t>(names_.size()))
+                  .first->second;
+  }
+  append(event_kind::spawn, self.id(), parent != nullptr ? parent->id() : 0,
+         name_id);
+}
+
+void trace_profiler::remove_actor(const local_actor& self) {
+  append(event_kind::remove, self.id(), 0);
+}
+
+void trace_profiler::before_processing(const local_actor& self,
+                                       const mailbox_element& element) {
+  append(event_kind::before_processing, self.id(), address_of(element));
+}
+
+void trace_profiler::after_processing(const local_actor& self,
+                                      invoke_message_result result) {
+  append(event_kind::after_processing, self.id(), 0, 0,
+         static_cast<uint8_t>(result));
+}
+
+void trace_profiler::before_sending(const local_actor& self,
+                                    mailbox_element& element) {
+  append(event_kind::send, self.id(), address_of(element));
+}
+
+void trace_profiler::before_sending_scheduled(const local_actor& self,
+                                              actor_clock::time_point,
+                                              mailbox_element& element) {
+  append(event_kind::send_scheduled, self.id(), address_of(element));
+}
+
+// -- private utility ----------------------------------------------------------
+
+void trace_profiler::append(event_kind kind, uint64_t actor, uint64_t arg,
+                            uint16_t name_id, uint8_t result) {
+  if (!recording())
+    return;
+  auto& buf = local_buffer();
+  std::lock_guard<std::mutex> guard{buf.mtx};
+  if (buf.closed)
+    return;
+  buf.records.emplace_back(record{now(), actor, arg, thread_index(), name_id,
+                                  static_cast<uint8_t>(kind), result});
+  if (buf.records.size() == chunk_size) {
+    write(buf.records.data(), buf.records.size());
+    buf.records.clear();
+  }
+}
+
+trace_profiler::thread_buffer& trace_profiler::local_buffer() {
+  // Threads may outlive profilers and vice versa. Hence, each thread keeps
+  // shared ownership of its buffers and drops them once the owner closed them.
+  thread_local std::vector<std::shared_ptr<thread_buffer>> buffers;
+  for (auto& buf : buffers)
+    if (buf->owner == id_ && !buf->closed)
+      return *buf;
+  auto is_closed = [](const auto& buf) { return buf->closed.load(); };
+  buffers.erase(std::remove_if(buffers.begin(), buffers.end(), is_closed),
+                buffers.end());
+  auto buf = std::make_shared<thread_buffer>(id_);
+  { // Lock scope.
+    std::lock_guard<std::mutex> guard{mtx_};
+    buffers_.emplace_back(buf);
+  }
+  buffers.emplace_back(buf);
+  return *buf;
+}
+
+void trace_profiler::write(const record* first, size_t num_records) {
+  std::lock_guard<std::mutex> guard{file_mtx_};
+  if (file_ != nullptr)
+    std::fwrite(first, sizeof(record), num_records, file_);
+}
+
+// -- conversion ---------------------------------------------------------------
+
+namespace {
+
+std::string quoted(const std::string& str) {
+  std::string result;
+  result.reserve(str.size() + 2);
+  result += '"';
+  for (auto c : str) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+      result += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      result += '?';
+    } else {
+      result += c;
+    }
+  }
+  result += '"';
+  return result;
+}
+
+// Prints a nanosecond timestamp in microseconds, as required by the format.
+void print_us(std::ostream& out, uint64_t ns) {
+  auto frac = std::to_string(ns % 1000);
+  out << (ns / 1000) << '.' << std::string(3 - frac.size(), '0') << frac;
+}
+
+} // namespace
+
+error trace_profiler::convert_to_json(std::istream& in, std::ostream& out) {
+  using kind = event_kind;
+  // Read and verify the header.
+  char hdr_magic[sizeof(magic)];
+  uint32_t header[2];
+  in.read(hdr_magic, sizeof(hdr_magic));
+  in.read(reinterpret_cast<char*>(header), sizeof(header));
+  if (!in || memcmp(hdr_magic, magic, sizeof(magic)) != 0)
+    return make_error(sec::invalid_argument, "input is not a CAF trace");
+  if (header[0] != version || header[1] != sizeof(record))
+    return make_error(sec::invalid_argument, "unsupported trace version");
+  // Read all records plus the name table. A missing name table usually means
+  // that the application crashed. In this case, we print actor IDs only.
+  std::vector<record> records;
+  std::vector<std::string> names;
+  record rec;
+  while (in.read(reinterpret_cast<char*>(&rec), sizeof(record))) {
+    if (rec.kind == static_cast<uint8_t>(kind::end_of_records)) {
+      names.resize(rec.arg);
+      for (auto& name : names) {
+        uint16_t len = 0;
+        in.read(reinterpret_cast<char*>(&len), sizeof(uint16_t));
+        name.resize(len);
+        in.read(name.data(), len);
+      }
+      if (!in)
+        return make_error(sec::invalid_argument, "truncated name table");
+      break;
+    }
+    records.emplace_back(rec);
+  }
+  // Threads write their records in chunks, i.e., out of order.
+  auto by_timestamp = [](const record& x, const record& y) {
+    return x.timestamp < y.timestamp;
+  };
+  std::stable_sort(records.begin(), records.end(), by_timestamp);
+  auto t0 = records.empty() ? uint64_t{0} : records.front().timestamp;
+  // Actor names are only known after the spawn event.
+  std::map<uint64_t, std::string> actor_names;
+  auto actor_name = [&](uint64_t aid) {
+    if (auto i = actor_names.find(aid); i != actor_names.end())
+      return i->second;
+    return quoted("actor" + std::to_string(aid));
+  };
+  // Maps element addresses to flow IDs. Allocators may re-use addresses, so
+  // we drop the entry once the receiver picks up the element.
+  struct pending_send {
+    uint64_t flow_id;
+    uint64_t timestamp;
+  };
+  std::map<uint64_t, pending_send> pending_sends;
+  uint64_t next_flow_id = 1;
+  // Actors may process messages in a nested fashion (blocking receives), so we
+  // keep a stack of open slices per thread.
+  std::map<uint32_t, std::vector<record>> open_slices;
+  std::set<uint32_t> threads;
+  auto sep = "\n";
+  auto begin_event = [&](const char* ph, uint64_t ts, uint32_t tid) {
+    threads.emplace(tid);
+    out << sep << R"({"ph":")" << ph << R"(","pid":1,"tid":)" << tid
+        << R"(,"ts":)";
+    print_us(out, ts - t0);
+    sep = ",\n";
+  };
+  out << R"({"displayTimeUnit":"ns","traceEvents":[)";
+  for (auto& x : records) {
+    switch (static_cast<kind>(x.kind)) {
+      case kind::spawn: {
+        auto name = x.name_id < names.size() ? names[x.name_id] : "actor";
+        name += '#';
+        name += std::to_string(x.actor);
+        auto& qname = actor_names[x.actor];
+        qname = quoted(name);
+        begin_event("i", x.timestamp, x.thread);
+        out << R"(,"s":"t","cat":"lifetime","name":"spawn","args":{"actor":)"
+            << qname << R"(,"parent":)" << actor_name(x.arg) << "}}";
+        break;
+      }
+      case kind::remove:
+        begin_event("i", x.timestamp, x.thread);
+        out << R"(,"s":"t","cat":"lifetime","name":"remove","args":{"actor":)"
+            << actor_name(x.actor) << "}}";
+        break;
+      case kind::send:
+      case kind::send_scheduled: {
+        auto flow_id = next_flow_id++;
+        pending_sends[x.arg] = pending_send{flow_id, x.timestamp};
+        begin_event("s", x.timestamp, x.thread);
+        out << R"(,"cat":"message","name":"message","id":)" << flow_id
+            << "}";
+        break;
+      }
+      case kind::before_processing:
+        open_slices[x.thread].emplace_back(x);
+        break;
+      case kind::after_processing: {
+        auto& stack = open_slices[x.thread];
+        if (stack.empty())
+          break;
+        auto start = stack.back();
+        stack.pop_back();
+        begin_event("X", start.timestamp, x.thread);
+        out << R"(,"dur":)";
+        print_us(out, x.timestamp - start.timestamp);
+        out << R"(,"cat":"processing","name":)" << actor_name(start.actor)
+            << R"(,"args":{"result":")"
+            << to_string(static_cast<invoke_message_result>(x.result)) << '"';
+        auto i = pending_sends.find(start.arg);
+        if (i == pending_sends.end()) {
+          out << "}}";
+          break;
+        }
+        out << R"(,"mailbox_time_us":)";
+        print_us(out, start.timestamp - i->second.timestamp);
+        out << "}}";
+        begin_event("f", start.timestamp, x.thread);
+        out << R"(,"bp":"e","cat":"message","name":"message","id":)"
+            << i->second.flow_id << "}";
+        pending_sends.erase(i);
+        break;
+      }
+      default:
+        break;
+    }
+  }
+  for (auto tid : std::vector<uint32_t>{threads.begin(), threads.end()}) {
+    begin_event("M", t0, tid);
+    out << R"(,"name":"thread_name","args":{"name":"thread )" << tid
+        << R"("}})";
+  }
+  out << "\n]}\n";
+  return none;
+}
+
+} // namespace caf
@@ -0,0 +1,158 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#include "caf/tracer.hpp"
+
+#include <limits>
+
+#include "caf/detail/print.hpp"
+#include "caf/local_actor.hpp"
+#include "caf/string_view.hpp"
+
+namespace caf {
+
+namespace {
+
+void append(std::string& buf, string_view str) {
+  buf.insert(buf.end(), str.begin(), str.end());
+}
+
+void append_nanos(std::string& buf, timestamp ts) {
+  buf.push_back('"');
+  detail::print(buf, ts.time_since_epoch().count());
+  buf.push_back('"');
+}
+
+uint64_t make_threshold(double sample_rate) {
+  using limits = std::numeric_limits<uint64_t>;
+  if (sample_rate >= 1.0)
+    return limits::max();
+  if (sample_rate <= 0.0)
+    return 0;
+  auto max = static_cast<double>(limits::max());
+  return static_cast<uint64_t>(sample_rate * max);
+}
+
+} // namespace
+
+// -- constructors, destructors, and assignment operators ----------------------
+
+tracer::tracer(double sample_rate, std::string path, std::string service_name)
+  : sample_rate_(sample_rate),
+    threshold_(make_threshold(sample_rate)),
+    service_name_(std::move(service_name)) {
+  if (!path.empty())
+    file_ = fopen(path.c_str(), "a");
+  buf_.reserve(batch_size);
+}
+
+tracer::~tracer() {
+  flush();
+  if (file_ != nullptr)
+    fclose(file_);
+}
+
+// -- properties ---------------------------------------------------------------
+
+size_t tracer::recorded_spans() const noexcept {
+  std::unique_lock<std::mutex> guard{mtx_};
+  return recorded_;
+}
+
+// -- tracing ------------------------------------------------------------------
+
+void tracer::start_trace(trace_context& ctx) {
+  // Sampling on the trace ID keeps the decision consistent with other
+  // implementations of the W3C TraceIdRatioBased sampler.
+  auto root = trace_context::make_root(trace_context::sampled_flag);
+  if (threshold_ == std::numeric_limits<uint64_t>::max()
+      || root.trace_id_low < threshold_)
+    ctx = root;
+}
+
+void tracer::record(const local_actor& self, const trace_context& ctx,
+                    timestamp start, timestamp end) {
+  std::vector<span> batch;
+  { // Lifetime scope of guard.
+    std::unique_lock<std::mutex> guard{mtx_};
+    ++recorded_;
+    if (file_ == nullptr)
+      return;
+    buf_.emplace_back(span{ctx, self.id(), self.name(), start, end});
+    if (buf_.size() < batch_size)
+      return;
+    batch.swap(buf_);
+    buf_.reserve(batch_size);
+  }
+  std::unique_lock<std::mutex> guard{file_mtx_};
+  write(batch);
+}
+
+void tracer::flush() {
+  std::vector<span> batch;
+  { // Lifetime scope of guard.
+    std::unique_lock<std::mutex> guard{mtx_};
+    batch.swap(buf_);
+  }
+  std::unique_lock<std::mutex> guard{file_mtx_};
+  if (!batch.empty())
+    write(batch);
+  if (file_ != nullptr)
+    fflush(file_);
+}
+
+void tracer::write(const std::vector<span>& spans) {
+  // Renders an ExportTraceServiceRequest in the OTLP/JSON encoding, i.e., the
+  // output file has the same format as the file exporter of OTel collectors.
+  std::string buf;
+  buf.reserve(256 * spans.size());
+  append(buf, R"({"resourceSpans":[{"resource":{"attributes":[)");
+  append(buf, R"({"key":"service.name","value":{"stringValue":)");
+  detail::print_escaped(buf, service_name_);
+  append(buf, R"(}}]},"scopeSpans":[{"scope":{"name":"caf"},"spans":[)");
+  auto first = true;
+  for (const auto& x : spans) {
+    if (first)
+      first = false;
+    else
+      buf.push_back(',');
+    append(buf, R"({"traceId":")");
+    append(buf, x.context.trace_id_hex());
+    append(buf, R"(","spanId":")");
+    append(buf, to_hex_span_id(x.context.span_id));
+    if (x.context.parent_span_id != 0) {
+      append(buf, R"(","parentSpanId":")");
+      append(buf, to_hex_span_id(x.context.parent_span_id));
+    }
+    append(buf, R"(","name":)");
+    detail::print_escaped(buf, x.name);
+    append(buf, R"(,"kind":5,"startTimeUnixNano":)");
+    append_nanos(buf, x.start);
+    append(buf, R"(,"endTimeUnixNano":)");
+    append_nanos(buf, x.end);
+    append(buf, R"(,"attributes":[{"key":"caf.actor.id",)");
+    append(buf, R"("value":{"intValue":")");
+    detail::print(buf, x.actor);
+    append(buf, R"("}}]})");
+  }
+  append(buf, "]}]}]}\n");
+  fwrite(buf.data(), 1, buf.size(), file_);
+}
+
+} // namespace caf
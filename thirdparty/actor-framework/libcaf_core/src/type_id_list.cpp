@@ -18,7 +18,80 @@
 
 #include "caf/type_id_list.hpp"
 
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <unordered_set>
+
+#include "caf/byte.hpp"
 #include "caf/detail/meta_object.hpp"
+#include "caf/hash/fnv.hpp"
+#include "caf/raise_error.hpp"
+#include "caf/span.hpp"
+
+namespace caf::detail {
+
+namespace {
+
+size_t type_id_list_bytes(const type_id_t* xs) noexcept {
+  return (xs[0] + 1) * sizeof(type_id_t);
+}
+
+// Points to a size-prefixed list plus its hash. Compares by content.
+struct type_id_list_key {
+  const type_id_t* data;
+  size_t hash;
+};
+
+bool operator==(const type_id_list_key& x,
+                const type_id_list_key& y) noexcept {
+  return x.data[0] == y.data[0]
+         && memcmp(x.data, y.data, type_id_list_bytes(x.data)) == 0;
+}
+
+struct type_id_list_key_hash {
+  size_t operator()(const type_id_list_key& x) const noexcept {
+    return x.hash;
+  }
+};
+
+struct type_id_list_cache {
+  std::mutex mtx;
+  std::unordered_set<type_id_list_key, type_id_list_key_hash> lists;
+};
+
+type_id_list_cache& global_type_id_list_cache() {
+  // The cache is never destroyed, because type ID lists in static variables
+  // may outlive any other static object.
+  static auto* instance = new type_id_list_cache;
+  return *instance;
+}
+
+} // namespace
+
+const type_id_t* intern_type_id_list(const type_id_t* xs) {
+  CAF_ASSERT(xs != nullptr);
+  auto first = reinterpret_cast<const byte*>(xs);
+  auto bytes = type_id_list_bytes(xs);
+  auto key = type_id_list_key{
+    xs, caf::hash::fnv<size_t>::compute(make_span(first, bytes))};
+  auto& cache = global_type_id_list_cache();
+  std::unique_lock<std::mutex> guard{cache.mtx};
+  if (auto i = cache.lists.find(key); i != cache.lists.end())
+    return i->data;
+  // Store the hash in front of the list. Interned lists live forever.
+  auto vptr = malloc(sizeof(size_t) + bytes);
+  if (vptr == nullptr)
+    CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
+  auto block = reinterpret_cast<char*>(vptr);
+  memcpy(block, &key.hash, sizeof(size_t));
+  memcpy(block + sizeof(size_t), xs, bytes);
+  key.data = reinterpret_cast<const type_id_t*>(block + sizeof(size_t));
+  cache.lists.emplace(key);
+  return key.data;
+}
+
+} // namespace caf::detail
 
 namespace caf {
 
@@ -174,4 +174,142 @@ CAF_TEST(random_actor_pool) {
   self->send_exit(pool, exit_reason::user_shutdown);
 }
 
+CAF_TEST(join_shortest_queue_actor_pool) {
+  scoped_actor self{system};
+  auto pool = actor_pool::make(&context, 5, spawn_worker,
+                               actor_pool::join_shortest_queue());
+  for (int32_t i = 0; i < 10; ++i) {
+    self->request(pool, infinite, i, i)
+      .receive([&](int32_t res) { CAF_CHECK_EQUAL(res, i + i); },
+               HANDLE_ERROR);
+  }
+  self->send_exit(pool, exit_reason::user_shutdown);
+}
+
+CAF_TEST(power_of_two_choices_actor_pool) {
+  scoped_actor self{system};
+  auto pool = actor_pool::make(&context, 5, spawn_worker,
+                               actor_pool::power_of_two_choices());
+  for (int32_t i = 0; i < 10; ++i) {
+    self->request(pool, infinite, i, i)
+      .receive([&](int32_t res) { CAF_CHECK_EQUAL(res, i + i); },
+               HANDLE_ERROR);
+  }
+  self->send_exit(pool, exit_reason::user_shutdown);
+}
+
+CAF_TEST(consistent_hashing_actor_pool) {
+  scoped_actor self{system};
+  auto key = [](const message& msg) -> uint64_t {
+    if (auto xs = make_const_typed_message_view<int32_t, int32_t>(msg))
+      return static_cast<uint64_t>(get<0>(xs));
+    return 0;
+  };
+  auto pool = actor_pool::make(&context, 5, spawn_worker,
+                               actor_pool::consistent_hashing(key));
+  auto worker_for = [&](int32_t x) {
+    actor result;
+    self->request(pool, infinite, x, 1)
+      .receive(
+        [&](int32_t res) {
+          CAF_CHECK_EQUAL(res, x + 1);
+          auto sender = actor_cast<strong_actor_ptr>(self->current_sender());
+          CAF_REQUIRE(sender);
+          result = actor_cast<actor>(std::move(sender));
+        },
+        HANDLE_ERROR);
+    return result;
+  };
+  CAF_MESSAGE("messages with the same key go to the same worker");
+  std::vector<actor> assignment;
+  for (int32_t x = 0; x < 20; ++x)
+    assignment.emplace_back(worker_for(x));
+  for (int32_t x = 0; x < 20; ++x)
+    CAF_CHECK_EQUAL(worker_for(x), assignment[x]);
+  CAF_MESSAGE("removing a worker only re-assigns the keys of that worker");
+  auto removed = assignment.front();
+  self->send(pool, sys_atom_v, delete_atom_v, removed);
+  for (int32_t x = 0; x < 20; ++x) {
+    auto hdl = worker_for(x);
+    CAF_CHECK_NOT_EQUAL(hdl, removed);
+    if (assignment[x] != removed)
+      CAF_CHECK_EQUAL(hdl, assignment[x]);
+  }
+  self->send_exit(pool, exit_reason::user_shutdown);
+  anon_send_exit(removed, exit_reason::user_shutdown);
+}
+
+CAF_TEST(actor_pools_dispatch_messages_from_concurrent_senders) {
+  auto pool = actor_pool::make(&context, 5, spawn_worker,
+                               actor_pool::join_shortest_queue());
+  std::vector<std::thread> senders;
+  std::atomic<size_t> results{0};
+  for (int32_t n = 0; n < 4; ++n) {
+    senders.emplace_back([&, n] {
+      scoped_actor self{system};
+      for (int32_t i = 0; i < 100; ++i) {
+        self->request(pool, infinite, n, i)
+          .receive(
+            [&](int32_t res) {
+              if (res == n + i)
+                ++results;
+            },
+            HANDLE_ERROR);
+      }
+    });
+  }
+  for (auto& t : senders)
+    t.join();
+  CAF_CHECK_EQUAL(results.load(), 400u);
+  anon_send_exit(pool, exit_reason::user_shutdown);
+}
+
+CAF_TEST(elastic_actor_pool) {
+  using namespace std::literals::chrono_literals;
+  scoped_actor self{system};
+  auto spawn_slow_worker = [&] {
+    return system.spawn([]() -> behavior {
+      return {
+        [](int32_t x) {
+          std::this_thread::sleep_for(2ms);
+          return x;
+        },
+      };
+    });
+  };
+  actor_pool::elastic_config cfg;
+  cfg.min_workers = 1;
+  cfg.max_workers = 4;
+  cfg.backlog_threshold = 1;
+  cfg.idle_timeout = 50ms;
+  cfg.interval = 10ms;
+  auto pool = actor_pool::make(&context, cfg, spawn_slow_worker,
+                               actor_pool::round_robin());
+  auto await_workers = [&](size_t expected) {
+    for (int i = 0; i < 500; ++i) {
+      size_t num_workers = 0;
+      self->request(pool, infinite, sys_atom_v, get_atom_v)
+        .receive([&](std::vector<actor>& ws) { num_workers = ws.size(); },
+                 HANDLE_ERROR);
+      if (num_workers == expected)
+        return true;
+      std::this_thread::sleep_for(10ms);
+    }
+    return false;
+  };
+  CAF_MESSAGE("the pool starts with the minimum number of workers");
+  CAF_CHECK(await_workers(1));
+  CAF_MESSAGE("the pool grows up to the maximum when messages queue up");
+  for (int32_t i = 0; i < 200; ++i)
+    self->send(pool, i);
+  CAF_CHECK(await_workers(4));
+  int32_t received = 0;
+  self->receive_for(received, 200)([](int32_t) {
+    // nop
+  });
+  CAF_MESSAGE("the pool retires idle workers after the cool-down");
+  CAF_CHECK(await_workers(1));
+  self->send_exit(pool, exit_reason::user_shutdown);
+}
+
 CAF_TEST_FIXTURE_SCOPE_END()
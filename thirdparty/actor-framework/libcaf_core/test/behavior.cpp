@@ -104,6 +104,34 @@ CAF_TEST(multiple_lambda_construct) {
   CAF_CHECK_EQUAL(res_of(f, m3), none);
 }
 
+CAF_TEST(dispatch_table_preserves_first_match_semantics) {
+  behavior f{
+    [](int8_t) { return int32_t{1}; },
+    [](int16_t) { return int32_t{2}; },
+    [](int32_t) { return int32_t{3}; },
+    [](int64_t) { return int32_t{4}; },
+    [](uint8_t) { return int32_t{5}; },
+    [](uint16_t) { return int32_t{6}; },
+    [](int32_t x) { return x; },
+    [](int32_t, int32_t) { return int32_t{7}; },
+    [](get_atom, int32_t) { return int32_t{8}; },
+    [](put_atom, int32_t) { return int32_t{9}; },
+  };
+  auto run = [&](message msg) { return res_of(f, msg); };
+  CAF_CHECK_EQUAL(run(make_message(int8_t{0})), 1);
+  CAF_CHECK_EQUAL(run(make_message(int16_t{0})), 2);
+  CAF_CHECK_EQUAL(run(make_message(int32_t{0})), 3);
+  CAF_CHECK_EQUAL(run(make_message(int64_t{0})), 4);
+  CAF_CHECK_EQUAL(run(make_message(uint8_t{0})), 5);
+  CAF_CHECK_EQUAL(run(make_message(uint16_t{0})), 6);
+  CAF_CHECK_EQUAL(run(make_message(int32_t{1}, int32_t{2})), 7);
+  CAF_CHECK_EQUAL(run(make_message(get_atom_v, int32_t{0})), 8);
+  CAF_CHECK_EQUAL(run(make_message(put_atom_v, int32_t{0})), 9);
+  CAF_CHECK_EQUAL(run(make_message(ok_atom_v, int32_t{0})), none);
+  CAF_CHECK_EQUAL(run(make_message()), none);
+  CAF_CHECK_EQUAL(run(m3), none);
+}
+
 CAF_TEST(become_empty_behavior) {
   actor_system_config cfg{};
   actor_system sys{cfg};
@@ -0,0 +1,92 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#define CAF_SUITE detail.topic_trie
+
+#include "caf/detail/topic_trie.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+struct fixture {
+  detail::topic_trie<int> trie;
+
+  std::vector<int> matches(string_view topic) {
+    std::vector<int> result;
+    trie.for_each_match(topic, [&](int x) { result.emplace_back(x); });
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+};
+
+using ivec = std::vector<int>;
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(topic_trie_tests, fixture)
+
+CAF_TEST(wildcards must occupy entire levels) {
+  using trie_type = detail::topic_trie<int>;
+  CAF_CHECK(trie_type::valid_filter("sensors"));
+  CAF_CHECK(trie_type::valid_filter("sensors/1/temp"));
+  CAF_CHECK(trie_type::valid_filter("sensors/+/temp"));
+  CAF_CHECK(trie_type::valid_filter("sensors/#"));
+  CAF_CHECK(trie_type::valid_filter("+/+"));
+  CAF_CHECK(trie_type::valid_filter("#"));
+  CAF_CHECK(!trie_type::valid_filter(""));
+  CAF_CHECK(!trie_type::valid_filter("sensors/#/temp"));
+  CAF_CHECK(!trie_type::valid_filter("sensors/1+/temp"));
+  CAF_CHECK(!trie_type::valid_filter("sensors#"));
+}
+
+CAF_TEST(tries store each filter only once) {
+  CAF_CHECK(trie.insert("sensors/+/temp", 1));
+  CAF_CHECK(!trie.insert("sensors/+/temp", 2));
+  CAF_CHECK(trie.insert("sensors/+", 3));
+  CAF_CHECK_EQUAL(trie.size(), 2u);
+  CAF_CHECK_EQUAL(matches("sensors/1/temp"), ivec({1}));
+  trie.clear();
+  CAF_CHECK(trie.empty());
+  CAF_CHECK_EQUAL(matches("sensors/1/temp"), ivec({}));
+}
+
+CAF_TEST(topics match filters with wildcards) {
+  trie.insert("sensors/1/temp", 1);
+  trie.insert("sensors/+/temp", 2);
+  trie.insert("sensors/#", 3);
+  trie.insert("#", 4);
+  trie.insert("+/1/+", 5);
+  trie.insert("actuators/+", 6);
+  CAF_CHECK_EQUAL(matches("sensors/1/temp"), ivec({1, 2, 3, 4, 5}));
+  CAF_CHECK_EQUAL(matches("sensors/2/temp"), ivec({2, 3, 4}));
+  CAF_CHECK_EQUAL(matches("sensors/1/humidity"), ivec({3, 4, 5}));
+  CAF_CHECK_EQUAL(matches("sensors"), ivec({3, 4}));
+  CAF_CHECK_EQUAL(matches("sensors/1/temp/raw"), ivec({3, 4}));
+  CAF_CHECK_EQUAL(matches("actuators/1"), ivec({4, 6}));
+  CAF_CHECK_EQUAL(matches("actuators"), ivec({4}));
+  CAF_CHECK_EQUAL(matches("actuators/1/valve"), ivec({4, 5}));
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
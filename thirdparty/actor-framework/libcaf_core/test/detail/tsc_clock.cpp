@@ -0,0 +1,45 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE detail.tsc_clock
+
+#include "caf/detail/tsc_clock.hpp"
+
+#include "caf/test/dsl.hpp"
+
+using namespace caf;
+
+using namespace std::chrono_literals;
+
+CAF_TEST(the TSC clock is monotonic) {
+  auto t0 = detail::tsc_clock::now();
+  for (int i = 0; i < 100; ++i) {
+    auto t1 = detail::tsc_clock::now();
+    CAF_REQUIRE_LESS_OR_EQUAL(t0, t1);
+    t0 = t1;
+  }
+}
+
+CAF_TEST(the TSC clock is compatible to the steady clock) {
+  // Generous bounds to avoid spurious failures on busy machines.
+  auto t0 = std::chrono::steady_clock::now();
+  auto t1 = detail::tsc_clock::now();
+  auto t2 = std::chrono::steady_clock::now();
+  CAF_CHECK_LESS(t0 - 50ms, t1);
+  CAF_CHECK_LESS(t1, t2 + 50ms);
+}
@@ -385,6 +385,37 @@ CAF_TEST(function_spawn) {
   self->send_exit(a2, exit_reason::user_shutdown);
 }
 
+CAF_TEST(batch_spawn) {
+  scoped_actor self{system};
+  auto running = system.registry().running();
+  auto f = [](const std::string& name) -> behavior {
+    return ([name](get_atom) { return make_result(name_atom_v, name); });
+  };
+  auto xs = system.spawn_n(10, f, "alice");
+  CAF_REQUIRE_EQUAL(xs.size(), 10u);
+  CAF_CHECK_EQUAL(system.registry().running(), running + 10);
+  for (size_t i = 1; i < xs.size(); ++i)
+    CAF_CHECK_EQUAL(xs[i].id(), xs[0].id() + i);
+  for (auto& x : xs) {
+    self->send(x, get_atom_v);
+    self->receive([&](name_atom, const std::string& name) {
+      CAF_CHECK_EQUAL(name, "alice");
+    });
+  }
+  auto mirrors = system.spawn_n<simple_mirror>(3);
+  CAF_REQUIRE_EQUAL(mirrors.size(), 3u);
+  for (auto& x : mirrors) {
+    self->send(x, "hello mirror");
+    self->receive(
+      [](const std::string& msg) { CAF_CHECK_EQUAL(msg, "hello mirror"); });
+  }
+  for (auto& x : xs)
+    self->send_exit(x, exit_reason::user_shutdown);
+  for (auto& x : mirrors)
+    self->send_exit(x, exit_reason::user_shutdown);
+  CAF_CHECK(system.spawn_n(0, f, "bob").empty());
+}
+
 using typed_testee = typed_actor<replies_to<abc_atom>::with<std::string>>;
 
 typed_testee::behavior_type testee() {
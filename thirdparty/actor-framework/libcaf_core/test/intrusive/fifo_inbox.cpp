@@ -23,7 +23,9 @@
 
 #include "caf/test/unit_test.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "caf/intrusive/drr_queue.hpp"
 #include "caf/intrusive/singly_linked.hpp"
@@ -120,6 +122,35 @@ CAF_TEST(push_after_close) {
   CAF_REQUIRE_EQUAL(res, inbox_result::queue_closed);
 }
 
+CAF_TEST(push_back_all) {
+  fill(inbox, 1);
+  std::vector<inode_policy::unique_pointer> xs;
+  for (int i = 2; i < 5; ++i)
+    xs.emplace_back(new inode(i));
+  CAF_REQUIRE_EQUAL(inbox.push_back_all(xs), inbox_result::success);
+  CAF_CHECK(std::all_of(xs.begin(), xs.end(),
+                        [](const auto& x) { return x == nullptr; }));
+  fill(inbox, 5);
+  CAF_REQUIRE_EQUAL(close_and_fetch(), "12345");
+}
+
+CAF_TEST(push_back_all_unblocks) {
+  CAF_REQUIRE_EQUAL(inbox.try_block(), true);
+  std::vector<inode_policy::unique_pointer> xs;
+  xs.emplace_back(new inode(1));
+  xs.emplace_back(new inode(2));
+  CAF_REQUIRE_EQUAL(inbox.push_back_all(xs), inbox_result::unblocked_reader);
+  CAF_REQUIRE_EQUAL(close_and_fetch(), "12");
+}
+
+CAF_TEST(push_back_all_after_close) {
+  inbox.close();
+  std::vector<inode_policy::unique_pointer> xs;
+  xs.emplace_back(new inode(1));
+  CAF_REQUIRE_EQUAL(inbox.push_back_all(xs), inbox_result::queue_closed);
+  CAF_CHECK_NOT_EQUAL(xs.front(), nullptr);
+}
+
 CAF_TEST(unblock) {
   CAF_REQUIRE_EQUAL(inbox.try_block(), true);
   auto res = inbox.push_back(new inode(0));
@@ -113,6 +113,22 @@ CAF_TEST(push_after_close) {
   CAF_REQUIRE_EQUAL(res, inbox_result::queue_closed);
 }
 
+CAF_TEST(push_front_chain) {
+  fill(inbox, 1, 2);
+  auto tail = new inode(3);
+  auto head = new inode(4);
+  head->next = tail;
+  CAF_REQUIRE_EQUAL(inbox.push_front_chain(head, tail), inbox_result::success);
+  CAF_REQUIRE_EQUAL(close_and_fetch(), "4321");
+}
+
+CAF_TEST(push_front_chain_after_close) {
+  inbox.close();
+  inode x{1};
+  CAF_REQUIRE_EQUAL(inbox.push_front_chain(&x, &x),
+                    inbox_result::queue_closed);
+}
+
 CAF_TEST(unblock) {
   CAF_REQUIRE_EQUAL(inbox.try_block(), true);
   auto res = inbox.push_front(new inode(1));
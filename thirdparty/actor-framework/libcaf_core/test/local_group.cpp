@@ -82,5 +82,40 @@ CAF_TEST(class_based_joined_at_spawn) {
     self->send_exit(x, exit_reason::user_shutdown);
 }
 
+CAF_TEST(large groups deliver messages in parallel) {
+  actor_system_config cfg;
+  put(cfg.content, "caf.groups.fan-out-threshold", 8);
+  actor_system sys{cfg};
+  scoped_actor self{sys};
+  auto grp = sys.groups().get_local("large");
+  constexpr int num_messages = 100;
+  auto receiver = [](event_based_actor* self, actor listener) -> behavior {
+    auto last = std::make_shared<int>(0);
+    return {
+      [=](put_atom, int x) {
+        // Group messages must arrive in the order of sending.
+        if (x != *last + 1)
+          *last = -1;
+        else
+          ++*last;
+        if (x == num_messages)
+          self->send(listener, ok_atom_v, *last);
+      },
+    };
+  };
+  std::vector<actor> xs;
+  for (int i = 0; i < 20; ++i)
+    xs.emplace_back(sys.spawn_in_group(grp, receiver,
+                                      actor_cast<actor>(self)));
+  for (int i = 1; i <= num_messages; ++i)
+    self->send(grp, put_atom_v, i);
+  int received = 0;
+  self->receive_for(received, 20)([&](ok_atom, int last) { //
+    CAF_CHECK_EQUAL(last, num_messages);
+  });
+  for (auto& x : xs)
+    self->send_exit(x, exit_reason::user_shutdown);
+}
+
 CAF_TEST_FIXTURE_SCOPE_END()
 
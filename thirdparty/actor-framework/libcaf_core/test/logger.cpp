@@ -22,8 +22,12 @@
 
 #include "core-test.hpp"
 
+#include <cstdio>
 #include <ctime>
+#include <fstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "caf/all.hpp"
 
@@ -213,4 +217,34 @@ CAF_TEST(render_fun_prefix) {
   foo::tpl<T>::run();
 }
 
+CAF_TEST(the logger collects events from all threads) {
+  constexpr int num_threads = 4;
+  // Log more events than fit into a single buffer to cover full buffers.
+  constexpr int num_events = static_cast<int>(logger::queue_size) * 4;
+  const char* path = "caf-logger-test.log";
+  cfg.set("caf.logger.file.path", path);
+  cfg.set("caf.logger.file.format", "%m%n");
+  {
+    actor_system sys{cfg};
+    auto& lg = sys.logger();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; ++i)
+      threads.emplace_back([&lg] {
+        for (int j = 0; j < num_events; ++j)
+          lg.log(CAF_LOG_MAKE_EVENT(0, "caf", CAF_LOG_LEVEL_DEBUG,
+                                    "test-event" << j));
+      });
+    for (auto& t : threads)
+      t.join();
+  }
+  std::ifstream in{path};
+  int received = 0;
+  for (string line; std::getline(in, line);)
+    if (line.compare(0, 10, "test-event") == 0)
+      ++received;
+  in.close();
+  std::remove(path);
+  CAF_CHECK_EQUAL(received, num_threads * num_events);
+}
+
 CAF_TEST_FIXTURE_SCOPE_END()
@@ -0,0 +1,146 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE mailbox_overflow_policy
+
+#include "caf/mailbox_overflow_policy.hpp"
+
+#include "core-test.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "caf/event_based_actor.hpp"
+#include "caf/scoped_actor.hpp"
+
+using namespace caf;
+
+namespace {
+
+struct testee_state {
+  std::vector<int32_t> received;
+  size_t max_mailbox_size = 0;
+};
+
+class testee : public event_based_actor {
+public:
+  testee(actor_config& cfg, size_t capacity, mailbox_overflow_policy policy,
+         testee_state* state, timespan delay = timespan{0})
+    : event_based_actor(cfg), state_(state), delay_(delay) {
+    set_mailbox_capacity(capacity, policy);
+  }
+
+  behavior make_behavior() override {
+    return {
+      [this](int32_t x) {
+        state_->received.emplace_back(x);
+        state_->max_mailbox_size = std::max(state_->max_mailbox_size,
+                                            mailbox_size_hint());
+        if (delay_.count() > 0)
+          std::this_thread::sleep_for(delay_);
+      },
+    };
+  }
+
+private:
+  testee_state* state_;
+  timespan delay_;
+};
+
+using ivec = std::vector<int32_t>;
+
+struct fixture : test_coordinator_fixture<> {
+  testee_state state;
+
+  actor spawn_testee(mailbox_overflow_policy policy) {
+    return sys.spawn<testee>(size_t{2}, policy, &state);
+  }
+
+  void send_range(const actor& dest, int32_t first, int32_t last) {
+    for (auto i = first; i < last; ++i)
+      self->send(dest, i);
+  }
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(mailbox_overflow_policy_tests, fixture)
+
+CAF_TEST(drop_newest drops incoming messages while the mailbox is full) {
+  auto dest = spawn_testee(mailbox_overflow_policy::drop_newest);
+  send_range(dest, 0, 5);
+  CAF_CHECK_EQUAL(dest->mailbox_size_hint(), 2u);
+  sched.run();
+  CAF_CHECK_EQUAL(state.received, ivec({0, 1}));
+  CAF_MESSAGE("the mailbox accepts new messages after processing old ones");
+  send_range(dest, 5, 10);
+  sched.run();
+  CAF_CHECK_EQUAL(state.received, ivec({0, 1, 5, 6}));
+}
+
+CAF_TEST(drop_oldest drops messages at the head of the mailbox) {
+  auto dest = spawn_testee(mailbox_overflow_policy::drop_oldest);
+  send_range(dest, 0, 5);
+  CAF_CHECK_EQUAL(dest->mailbox_size_hint(), 5u);
+  sched.run();
+  CAF_CHECK_EQUAL(state.received, ivec({3, 4}));
+  CAF_CHECK_EQUAL(dest->mailbox_size_hint(), 0u);
+}
+
+CAF_TEST(reject responds to requests with an error while the mailbox is full) {
+  auto dest = spawn_testee(mailbox_overflow_policy::reject);
+  send_range(dest, 0, 2);
+  self->request(dest, infinite, int32_t{2})
+    .receive([] { CAF_FAIL("expected an error"); },
+             [](error& err) { CAF_CHECK_EQUAL(err, sec::mailbox_full); });
+  sched.run();
+  CAF_CHECK_EQUAL(state.received, ivec({0, 1}));
+}
+
+CAF_TEST(bounded mailboxes never drop system messages) {
+  auto dest = spawn_testee(mailbox_overflow_policy::drop_newest);
+  send_range(dest, 0, 2);
+  anon_send_exit(dest, exit_reason::user_shutdown);
+  sched.run();
+  CAF_CHECK_EQUAL(state.received, ivec({0, 1}));
+  CAF_CHECK(dest->getf(abstract_actor::is_terminated_flag));
+}
+
+CAF_TEST(suspend blocks blocking senders until the mailbox has capacity) {
+  actor_system_config cfg;
+  cfg.set("caf.scheduler.max-threads", 2);
+  actor_system real_sys{cfg};
+  testee_state real_state;
+  auto dest = real_sys.spawn<testee>(size_t{2},
+                                     mailbox_overflow_policy::suspend,
+                                     &real_state, std::chrono::milliseconds(1));
+  scoped_actor sender{real_sys};
+  for (int32_t i = 0; i < 10; ++i)
+    sender->send(dest, i);
+  sender->request(dest, infinite, int32_t{10}).receive([] {}, [](error& err) {
+    CAF_FAIL("unexpected error: " << err);
+  });
+  ivec expected{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  CAF_CHECK_EQUAL(real_state.received, expected);
+  CAF_CHECK_LESS_OR_EQUAL(real_state.max_mailbox_size, 2u);
+  anon_send_exit(dest, exit_reason::user_shutdown);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -180,6 +180,38 @@ CAF_TEST(requesters support fan_out_request) {
   CAF_CHECK_EQUAL(*sum, 9);
 }
 
+CAF_TEST(requesters support many pending requests) {
+  constexpr int num_requests = 10'000;
+  // The server answers all requests at once and in reverse order.
+  auto server = sys.spawn([=](event_based_actor* self) -> behavior {
+    using pending_list = std::vector<std::pair<response_promise, int>>;
+    auto pending = std::make_shared<pending_list>();
+    return {
+      [=](int x) {
+        auto rp = self->make_response_promise();
+        pending->emplace_back(rp, x);
+        if (x == num_requests - 1) {
+          for (auto i = pending->rbegin(); i != pending->rend(); ++i)
+            i->first.deliver(i->second);
+          pending->clear();
+        }
+        return rp;
+      },
+    };
+  });
+  run();
+  auto received = std::make_shared<int>(0);
+  auto client = sys.spawn([=](event_based_actor* self) {
+    for (int i = 0; i < num_requests; ++i)
+      self->request(server, infinite, i).then([=](int x) {
+        CAF_CHECK_EQUAL(x, num_requests - 1 - *received);
+        ++*received;
+      });
+  });
+  run();
+  CAF_CHECK_EQUAL(*received, num_requests);
+}
+
 #ifdef CAF_ENABLE_EXCEPTIONS
 
 CAF_TEST(exceptions while processing requests trigger error messages) {
@@ -22,6 +22,7 @@
 
 #include "caf/test/dsl.hpp"
 
+#include <algorithm>
 #include <chrono>
 
 using namespace caf;
@@ -103,4 +104,80 @@ CAF_TEST(anonymous messages receive no response) {
   disallow((std::string), from(testee).to(self).with(hello));
 }
 
+CAF_TEST(lanes with higher weights receive more messages per round) {
+  std::string received;
+  auto f = [&received](event_based_actor* self) -> behavior {
+    self->set_message_lanes({1, 2});
+    return {
+      [&received](const std::string& str) { received += str; },
+    };
+  };
+  auto aut = sys.spawn(f);
+  sched.run();
+  CAF_CHECK_EQUAL(actor_cast<event_based_actor*>(aut)->num_message_lanes(),
+                  2u);
+  for (auto i = 0; i < 3; ++i) {
+    self->send_on_lane(0, aut, "a");
+    self->send_on_lane(1, aut, "b");
+  }
+  // Lanes that do not exist at the receiver map to lane 0.
+  anon_send_on_lane(9, aut, "c");
+  // The test coordinator allows actors to consume one message at a time.
+  // Hence, each round in the mailbox starts with a fresh quantum.
+  sched.run();
+  CAF_CHECK_EQUAL(received.size(), 7u);
+  CAF_CHECK_EQUAL(std::count(received.begin(), received.end(), 'b'), 3);
+  anon_send_exit(aut, exit_reason::user_shutdown);
+}
+
+CAF_TEST(batches arrive in order) {
+  std::vector<message> xs{make_message("a"), make_message("b"),
+                          make_message("c")};
+  self->send_batch(testee, xs);
+  for (std::string str : {"a", "b", "c"}) {
+    expect((std::string), from(self).to(testee).with(str));
+    expect((std::string), from(testee).to(self).with(str));
+  }
+  anon_send_batch(testee, xs);
+  for (std::string str : {"a", "b", "c"})
+    expect((std::string), to(testee).with(str));
+  disallow((std::string), from(testee).to(self).with(std::string{"a"}));
+}
+
+CAF_TEST(multicasts deliver the same message to all receivers) {
+  std::vector<actor> receivers{testee, sys.spawn(testee_impl),
+                               sys.spawn(testee_impl)};
+  receivers.emplace_back(); // Invalid handles are skipped.
+  self->multicast(receivers, hello);
+  for (size_t i = 0; i < 3; ++i) {
+    expect((std::string), from(self).to(receivers[i]).with(hello));
+    expect((std::string), from(receivers[i]).to(self).with(hello));
+  }
+  anon_multicast(receivers, make_message(hello));
+  for (size_t i = 0; i < 3; ++i)
+    expect((std::string), to(receivers[i]).with(hello));
+  disallow((std::string), to(self).with(hello));
+  for (size_t i = 1; i < 3; ++i)
+    anon_send_exit(receivers[i], exit_reason::user_shutdown);
+}
+
+CAF_TEST(multicast receivers share the message payload) {
+  std::vector<const void*> payloads;
+  auto f = [&](event_based_actor* self) -> behavior {
+    return {
+      [&payloads, self](const std::string&) {
+        payloads.emplace_back(self->current_mailbox_element()->payload.cptr());
+      },
+    };
+  };
+  std::vector<actor> receivers{sys.spawn(f), sys.spawn(f), sys.spawn(f)};
+  anon_multicast(receivers, hello);
+  sched.run();
+  CAF_REQUIRE_EQUAL(payloads.size(), 3u);
+  CAF_CHECK(payloads[0] == payloads[1]);
+  CAF_CHECK(payloads[1] == payloads[2]);
+  for (auto& receiver : receivers)
+    anon_send_exit(receiver, exit_reason::user_shutdown);
+}
+
 CAF_TEST_FIXTURE_SCOPE_END()
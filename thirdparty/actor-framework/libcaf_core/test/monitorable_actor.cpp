@@ -0,0 +1,99 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE monitorable_actor
+
+#include "caf/monitorable_actor.hpp"
+
+#include "core-test.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "caf/all.hpp"
+
+using namespace caf;
+
+namespace {
+
+behavior dummy_impl() {
+  return {
+    [](int x) { return x; },
+  };
+}
+
+struct fixture : test_coordinator_fixture<> {
+  actor aut;
+
+  fixture() {
+    aut = sys.spawn(dummy_impl);
+    run();
+  }
+
+  abstract_actor* aut_ptr() {
+    return actor_cast<abstract_actor*>(aut);
+  }
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(monitorable_actor_tests, fixture)
+
+CAF_TEST(attached functors run once after the actor terminates) {
+  std::atomic<int> calls{0};
+  for (int i = 0; i < 10; ++i)
+    aut_ptr()->attach_functor([&] { ++calls; });
+  CAF_CHECK_EQUAL(calls.load(), 0);
+  anon_send_exit(aut, exit_reason::user_shutdown);
+  run();
+  CAF_CHECK_EQUAL(calls.load(), 10);
+  CAF_MESSAGE("attaching to a terminated actor calls the functor immediately");
+  aut_ptr()->attach_functor([&](const error& reason) {
+    CAF_CHECK_EQUAL(reason, exit_reason::user_shutdown);
+    ++calls;
+  });
+  CAF_CHECK_EQUAL(calls.load(), 11);
+}
+
+CAF_TEST(demonitoring removes pending monitors) {
+  self->monitor(aut);
+  self->demonitor(aut);
+  anon_send_exit(aut, exit_reason::user_shutdown);
+  run();
+  CAF_CHECK_EQUAL(self->mailbox().size(), 0u);
+}
+
+CAF_TEST(concurrent attach calls never lose a functor) {
+  constexpr int num_threads = 4;
+  constexpr int attach_calls = 1000;
+  std::atomic<int> calls{0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i)
+    threads.emplace_back([&] {
+      for (int j = 0; j < attach_calls; ++j)
+        aut_ptr()->attach_functor([&] { ++calls; });
+    });
+  anon_send_exit(aut, exit_reason::user_shutdown);
+  run();
+  for (auto& t : threads)
+    t.join();
+  CAF_CHECK_EQUAL(calls.load(), num_threads * attach_calls);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
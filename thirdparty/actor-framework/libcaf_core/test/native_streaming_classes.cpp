@@ -165,6 +165,8 @@ public:
       name_(cstr_name),
       global_time_(global_time) {
     CAF_ASSERT(global_time_ != nullptr);
+    auto& lanes = get<normal_async_id::value>(mbox.queues());
+    lanes.policy().set_weights(lanes.queues(), {1});
   }
 
   void enqueue(mailbox_element_ptr what, execution_unit*) override {
@@ -381,6 +383,8 @@ struct msg_visitor {
   }
 
   result_type operator()(normal_async_id, entity::normal_queue&,
+                         policy::message_lanes::key_type,
+                         policy::message_lanes::nested_queue_type&,
                          mailbox_element& x) {
     CAF_REQUIRE(x.content().match_elements<open_stream_msg>());
     self->current_mailbox_element(&x);
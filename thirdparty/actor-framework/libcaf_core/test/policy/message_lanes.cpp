@@ -0,0 +1,107 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE policy.message_lanes
+
+#include "caf/policy/message_lanes.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include <string>
+#include <vector>
+
+#include "caf/intrusive/wdrr_dynamic_multiplexed_queue.hpp"
+#include "caf/make_message.hpp"
+#include "caf/no_stages.hpp"
+
+using namespace caf;
+
+namespace {
+
+using queue_type
+  = intrusive::wdrr_dynamic_multiplexed_queue<policy::message_lanes>;
+
+struct consumer {
+  std::string received;
+
+  intrusive::task_result operator()(uint8_t lane,
+                                    policy::message_lanes::nested_queue_type&,
+                                    mailbox_element& x) {
+    received += std::to_string(lane);
+    received += ':';
+    received += std::to_string(x.content().get_as<int32_t>(0));
+    received += ' ';
+    return intrusive::task_result::resume;
+  }
+};
+
+struct fixture {
+  queue_type queue{unit};
+
+  consumer f;
+
+  void push(uint8_t lane, int32_t x) {
+    auto ptr = make_mailbox_element(nullptr, make_message_id(), no_stages, x);
+    ptr->lane = lane;
+    queue.push_back(std::move(ptr));
+  }
+
+  void set_weights(std::vector<size_t> weights) {
+    queue.policy().set_weights(queue.queues(), weights);
+  }
+
+  std::string run_round(size_t quantum) {
+    f.received.clear();
+    queue.new_round(quantum, f);
+    return f.received;
+  }
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(message_lanes_tests, fixture)
+
+CAF_TEST(lanes receive quanta according to their weight) {
+  set_weights({1, 3});
+  for (int32_t i = 0; i < 4; ++i) {
+    push(0, i);
+    push(1, i);
+  }
+  CAF_CHECK_EQUAL(run_round(1), "0:0 1:0 1:1 1:2 ");
+  CAF_CHECK_EQUAL(run_round(1), "0:1 1:3 ");
+  CAF_CHECK_EQUAL(run_round(1), "0:2 ");
+  CAF_CHECK_EQUAL(run_round(1), "0:3 ");
+  CAF_CHECK(queue.empty());
+}
+
+CAF_TEST(messages for unknown lanes use the default lane) {
+  set_weights({1, 1});
+  push(7, 1);
+  push(1, 2);
+  CAF_CHECK_EQUAL(run_round(1), "0:1 1:2 ");
+}
+
+CAF_TEST(set_weights never removes lanes) {
+  set_weights({1, 1, 1});
+  set_weights({2});
+  CAF_CHECK_EQUAL(queue.policy().num_lanes, 3u);
+  CAF_CHECK_EQUAL(queue.queues().at(0).policy().weight, 2u);
+  CAF_CHECK_EQUAL(queue.queues().at(2).policy().weight, 1u);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -0,0 +1,130 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE policy.select_hedged
+
+#include "caf/policy/select_hedged.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/sec.hpp"
+
+using namespace caf;
+using namespace std::literals::chrono_literals;
+
+namespace {
+
+struct fixture : test_coordinator_fixture<> {
+  template <class F>
+  actor make_server(F f) {
+    auto init = [f]() -> behavior {
+      return {
+        [f](int x, int y) { return f(x, y); },
+      };
+    };
+    return sys.spawn(init);
+  }
+
+  fixture() {
+    auto f = [](int x, int y) { return x + y; };
+    servers = {make_server(f), make_server(f), make_server(f)};
+    run();
+  }
+
+  std::vector<actor> servers;
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(select_hedged_tests, fixture)
+
+CAF_TEST(hedged requests only go to the first destination if it responds) {
+  int result = 0;
+  auto client = sys.spawn([=, &result](event_based_actor* ptr) {
+    ptr->hedged_request(servers, infinite, 10ms, 1, 2)
+      .then([&result](int x) { result = x; });
+  });
+  run_once();
+  expect((int, int), from(client).to(servers[0]).with(1, 2));
+  expect((int), from(servers[0]).to(client).with(3));
+  CAF_CHECK_EQUAL(result, 3);
+  CAF_MESSAGE("the actor drops the remaining requests after the delay");
+  advance_time(10ms);
+  expect((error), from(_).to(client).with(sec::request_timeout));
+  disallow((int, int), from(client).to(servers[1]));
+  run();
+  CAF_CHECK_EQUAL(result, 3);
+}
+
+CAF_TEST(hedged requests go to the next destination after the hedge delay) {
+  int result = 0;
+  auto client = sys.spawn([=, &result](event_based_actor* ptr) {
+    ptr->hedged_request(servers, infinite, 10ms, 1, 2)
+      .then([&result](int x) { result = x; });
+  });
+  run_once();
+  CAF_MESSAGE("the first server does not respond within the hedge delay");
+  advance_time(10ms);
+  expect((error), from(_).to(client).with(sec::request_timeout));
+  expect((int, int), from(client).to(servers[1]).with(1, 2));
+  expect((int), from(servers[1]).to(client).with(3));
+  CAF_CHECK_EQUAL(result, 3);
+  CAF_MESSAGE("the actor ignores the late response");
+  expect((int, int), from(client).to(servers[0]).with(1, 2));
+  expect((int), from(servers[0]).to(client).with(3));
+  CAF_CHECK_EQUAL(result, 3);
+}
+
+CAF_TEST(hedged requests go to the next destination after an error) {
+  auto g = [](int, int) -> result<int> { return sec::invalid_argument; };
+  servers[0] = make_server(g);
+  run();
+  int result = 0;
+  auto client = sys.spawn([=, &result](event_based_actor* ptr) {
+    ptr->hedged_request(servers, infinite, 10ms, 1, 2)
+      .then([&result](int x) { result = x; },
+            [](error& err) { CAF_FAIL("unexpected error: " << err); });
+  });
+  run_once();
+  expect((int, int), from(client).to(servers[0]).with(1, 2));
+  expect((error), from(servers[0]).to(client).with(sec::invalid_argument));
+  expect((int, int), from(client).to(servers[1]).with(1, 2));
+  expect((int), from(servers[1]).to(client).with(3));
+  CAF_CHECK_EQUAL(result, 3);
+}
+
+CAF_TEST(hedged requests fail after all requests failed) {
+  auto g = [](int, int) -> result<int> { return sec::invalid_argument; };
+  servers = {make_server(g), make_server(g)};
+  run();
+  size_t errors = 0;
+  auto client = sys.spawn([=, &errors](event_based_actor* ptr) {
+    ptr->hedged_request(servers, infinite, 10ms, 1, 2)
+      .then([](int) { CAF_FAIL("unexpected result"); },
+            [&errors](error& err) {
+              CAF_CHECK_EQUAL(err, sec::all_requests_failed);
+              ++errors;
+            });
+  });
+  run();
+  CAF_CHECK_EQUAL(errors, 1u);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
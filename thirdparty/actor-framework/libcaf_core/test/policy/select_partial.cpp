@@ -0,0 +1,161 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE policy.select_partial
+
+#include "caf/policy/select_partial.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/sec.hpp"
+
+using caf::policy::select_partial;
+
+using namespace caf;
+
+namespace {
+
+struct fixture : test_coordinator_fixture<> {
+  template <class F>
+  actor make_server(F f) {
+    auto init = [f]() -> behavior {
+      return {
+        [f](int x, int y) { return f(x, y); },
+      };
+    };
+    return sys.spawn(init);
+  }
+
+  auto make_error_handler() {
+    return [](const error& err) { CAF_FAIL("unexpected error: " << err); };
+  }
+
+  auto make_counting_error_handler(size_t* count) {
+    return [count](const error&) { *count += 1; };
+  }
+};
+
+} // namespace
+
+#define SUBTEST(message)                                                       \
+  run();                                                                       \
+  CAF_MESSAGE("subtest: " message);                                            \
+  for (int subtest_dummy = 0; subtest_dummy < 1; ++subtest_dummy)
+
+CAF_TEST_FIXTURE_SCOPE(select_partial_tests, fixture)
+
+CAF_TEST(select_partial collects all successful results) {
+  auto f = [](int x, int y) { return x + y; };
+  auto g = [](int, int) -> result<int> { return sec::invalid_argument; };
+  auto server1 = make_server(f);
+  auto server2 = make_server(g);
+  auto server3 = make_server(f);
+  SUBTEST("request.receive") {
+    auto r1 = self->request(server1, infinite, 1, 2);
+    auto r2 = self->request(server2, infinite, 2, 3);
+    auto r3 = self->request(server3, infinite, 3, 4);
+    select_partial<detail::type_list<int>> choose{{r1.id(), r2.id(), r3.id()}};
+    run();
+    choose.receive(
+      self.ptr(),
+      [](std::vector<int> results) {
+        CAF_CHECK_EQUAL(results, std::vector<int>({3, 7}));
+      },
+      make_error_handler());
+  }
+  SUBTEST("request.then") {
+    std::vector<int> results;
+    auto client = sys.spawn([=, &results](event_based_actor* ptr) {
+      auto r1 = ptr->request(server1, infinite, 1, 2);
+      auto r2 = ptr->request(server2, infinite, 2, 3);
+      auto r3 = ptr->request(server3, infinite, 3, 4);
+      select_partial<detail::type_list<int>> choose{
+        {r1.id(), r2.id(), r3.id()}};
+      choose.then(
+        ptr, [&results](std::vector<int> xs) { results = std::move(xs); },
+        make_error_handler());
+    });
+    run_once();
+    expect((int, int), from(client).to(server1).with(1, 2));
+    expect((int, int), from(client).to(server2).with(2, 3));
+    expect((int, int), from(client).to(server3).with(3, 4));
+    expect((int), from(server1).to(client).with(3));
+    expect((error), from(server2).to(client).with(sec::invalid_argument));
+    CAF_CHECK(results.empty());
+    expect((int), from(server3).to(client).with(7));
+    CAF_CHECK_EQUAL(results, std::vector<int>({3, 7}));
+  }
+  SUBTEST("request.await") {
+    std::vector<int> results;
+    auto client = sys.spawn([=, &results](event_based_actor* ptr) {
+      auto r1 = ptr->request(server1, infinite, 1, 2);
+      auto r2 = ptr->request(server2, infinite, 2, 3);
+      select_partial<detail::type_list<int>> choose{{r1.id(), r2.id()}};
+      choose.await(
+        ptr, [&results](std::vector<int> xs) { results = std::move(xs); },
+        make_error_handler());
+    });
+    run();
+    CAF_CHECK_EQUAL(results, std::vector<int>({3}));
+  }
+}
+
+CAF_TEST(select_partial calls the error handler if all requests fail) {
+  auto g = [](int, int) -> result<int> { return sec::invalid_argument; };
+  auto server1 = make_server(g);
+  auto server2 = make_server(g);
+  SUBTEST("request.receive") {
+    auto r1 = self->request(server1, infinite, 1, 2);
+    auto r2 = self->request(server2, infinite, 2, 3);
+    select_partial<detail::type_list<int>> choose{{r1.id(), r2.id()}};
+    run();
+    size_t errors = 0;
+    choose.receive(
+      self.ptr(),
+      [](std::vector<int>) {
+        CAF_FAIL("fan-in policy called the result handler");
+      },
+      make_counting_error_handler(&errors));
+    CAF_CHECK_EQUAL(errors, 1u);
+  }
+  SUBTEST("request.then") {
+    size_t errors = 0;
+    auto client = sys.spawn([=, &errors](event_based_actor* ptr) {
+      auto r1 = ptr->request(server1, infinite, 1, 2);
+      auto r2 = ptr->request(server2, infinite, 2, 3);
+      select_partial<detail::type_list<int>> choose{{r1.id(), r2.id()}};
+      choose.then(
+        ptr,
+        [](std::vector<int>) {
+          CAF_FAIL("fan-in policy called the result handler");
+        },
+        make_counting_error_handler(&errors));
+    });
+    run_once();
+    expect((int, int), from(client).to(server1).with(1, 2));
+    expect((int, int), from(client).to(server2).with(2, 3));
+    expect((error), from(server1).to(client).with(sec::invalid_argument));
+    CAF_CHECK_EQUAL(errors, 0u);
+    expect((error), from(server2).to(client).with(sec::invalid_argument));
+    CAF_CHECK_EQUAL(errors, 1u);
+  }
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
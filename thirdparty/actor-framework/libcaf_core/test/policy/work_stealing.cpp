@@ -0,0 +1,97 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#define CAF_SUITE policy.work_stealing
+
+#include "caf/policy/work_stealing.hpp"
+
+#include "core-test.hpp"
+
+#include "caf/scoped_actor.hpp"
+#include "caf/telemetry/metric_registry.hpp"
+
+using namespace caf;
+
+namespace {
+
+constexpr size_t num_workers = 2;
+
+struct fixture {
+  fixture() : sys(init(cfg)) {
+    // nop
+  }
+
+  static actor_system_config& init(actor_system_config& cfg) {
+    cfg.set("caf.scheduler.policy", "stealing");
+    cfg.set("caf.scheduler.max-threads", num_workers);
+    return cfg;
+  }
+
+  template <class F>
+  int64_t sum(F fetch) {
+    int64_t result = 0;
+    for (size_t id = 0; id < num_workers; ++id) {
+      auto lbl = std::to_string(id);
+      result += fetch(sys.metrics(), lbl)->value();
+    }
+    return result;
+  }
+
+  int64_t sum_counters(string_view name) {
+    return sum([name](auto& reg, const std::string& id) {
+      return reg.counter_instance("caf.scheduler", name, {{"worker", id}}, "");
+    });
+  }
+
+  actor_system_config cfg;
+  actor_system sys;
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(work_stealing_tests, fixture)
+
+CAF_TEST(workers collect scheduler metrics) {
+  auto testee = sys.spawn([] {
+    return behavior{
+      [](int x) { return x; },
+    };
+  });
+  scoped_actor self{sys};
+  for (int i = 0; i < 10; ++i)
+    self->request(testee, infinite, i)
+      .receive([i](int x) { CAF_CHECK_EQUAL(x, i); },
+               [](const error& err) { CAF_FAIL("request failed: " << err); });
+  CAF_MESSAGE("the workers resumed the testee at least once");
+  // The testee may process several requests in a single resume.
+  CAF_CHECK_GREATER_OR_EQUAL(sum_counters("resumes"), 1);
+  CAF_MESSAGE("steal counters exist for all workers");
+  CAF_CHECK_GREATER_OR_EQUAL(sum_counters("steals"), 0);
+  CAF_CHECK_GREATER_OR_EQUAL(sum_counters("failed-steals"), 0);
+  CAF_CHECK_GREATER_OR_EQUAL(sum_counters("migrated-jobs"), 0);
+  CAF_MESSAGE("queue sizes never drop below zero");
+  CAF_CHECK_GREATER_OR_EQUAL(sum([](auto& reg, const std::string& id) {
+                               return reg.gauge_instance("caf.scheduler",
+                                                         "queue-size",
+                                                         {{"worker", id}}, "");
+                             }),
+                             0);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -86,4 +86,80 @@ some_request_duration_seconds_count{x="get"} 1 42000
   CAF_CHECK_EQUAL(res1, exporter.collect_from(registry));
 }
 
+CAF_TEST(the Prometheus collector renders HDR histograms as summaries) {
+  auto rt = registry.hdr_histogram_family("some", "response-time", {"x"},
+                                          "Some help.", "seconds");
+  auto h = rt->get_or_add({{"x", "get"}});
+  h->observe(1.);
+  h->observe(2.);
+  h->observe(4.);
+  CAF_CHECK_EQUAL(exporter.collect_from(registry, 42),
+                  R"(# HELP some_response_time_seconds Some help.
+# TYPE some_response_time_seconds summary
+some_response_time_seconds{x="get",quantile="0.5"} 2.125000 42000
+some_response_time_seconds{x="get",quantile="0.99"} 4.250000 42000
+some_response_time_seconds{x="get",quantile="0.999"} 4.250000 42000
+some_response_time_seconds_sum{x="get"} 7.000000 42000
+some_response_time_seconds_count{x="get"} 3 42000
+)"_sv);
+}
+
+CAF_TEST(the Prometheus collector only re-renders changed values) {
+  auto fb = registry.gauge_family("foo", "bar", {"x"}, "", "seconds");
+  auto ov = registry.gauge_family("other", "value", {}, "", "1");
+  fb->get_or_add({{"x", "1"}})->value(1);
+  ov->get_or_add({})->value(2);
+  CAF_CHECK_EQUAL(exporter.collect_from(registry, 42),
+                  R"(# TYPE foo_bar_seconds gauge
+foo_bar_seconds{x="1"} 1 42000
+# TYPE other_value gauge
+other_value 2 42000
+)"_sv);
+  CAF_MESSAGE("changing values and adding metrics updates the output");
+  fb->get_or_add({{"x", "1"}})->value(10);
+  fb->get_or_add({{"x", "2"}})->value(20);
+  CAF_CHECK_EQUAL(exporter.collect_from(registry, 43),
+                  R"(# TYPE foo_bar_seconds gauge
+foo_bar_seconds{x="1"} 10 43000
+foo_bar_seconds{x="2"} 20 43000
+# TYPE other_value gauge
+other_value 2 43000
+)"_sv);
+}
+
+CAF_TEST(the Prometheus collector renders large registries consistently) {
+  auto gauges = registry.gauge_family("some", "gauge", {"id"}, "", "1");
+  auto counters = registry.counter_family<double>("some", "counter", {"id"},
+                                                  "", "seconds", true);
+  std::vector<int64_t> upper_bounds{1, 10, 100};
+  auto histograms = registry.histogram_family("some", "histogram", {"id"},
+                                              upper_bounds, "", "1");
+  auto add_metrics = [&](int first, int last) {
+    for (int id = first; id < last; ++id) {
+      auto str = std::to_string(id);
+      gauges->get_or_add({{"id", str}})->value(id);
+      counters->get_or_add({{"id", str}})->inc(id / 2.);
+      if (id % 10 == 0)
+        histograms->get_or_add({{"id", str}})->observe(id % 1000);
+    }
+  };
+  auto render_fresh = [this](time_t now) {
+    collector::prometheus fresh;
+    auto str = fresh.collect_from(registry, now);
+    return std::string{str.begin(), str.end()};
+  };
+  add_metrics(0, 1'000);
+  CAF_CHECK_EQUAL(exporter.collect_from(registry, 42), render_fresh(42));
+  CAF_MESSAGE("the collector picks up changed values");
+  for (int id = 0; id < 1'000; id += 7) {
+    auto str = std::to_string(id);
+    gauges->get_or_add({{"id", str}})->inc();
+    counters->get_or_add({{"id", str}})->inc();
+  }
+  CAF_CHECK_EQUAL(exporter.collect_from(registry, 43), render_fresh(43));
+  CAF_MESSAGE("the collector picks up new metrics");
+  add_metrics(1'000, 1'100);
+  CAF_CHECK_EQUAL(exporter.collect_from(registry, 44), render_fresh(44));
+}
+
 CAF_TEST_FIXTURE_SCOPE_END()
@@ -22,6 +22,11 @@
 
 #include "caf/test/dsl.hpp"
 
+#include <thread>
+#include <vector>
+
+#include "caf/telemetry/sharded_int_counter.hpp"
+
 using namespace caf;
 
 CAF_TEST(double counters can only increment) {
@@ -49,3 +54,28 @@ CAF_TEST(integer counters can only increment) {
   CAF_MESSAGE("users can create counters with custom start values");
   CAF_CHECK_EQUAL(telemetry::int_counter{42}.value(), 42);
 }
+
+CAF_TEST(sharded integer counters can only increment) {
+  telemetry::sharded_int_counter c;
+  CAF_MESSAGE("counters start at 0");
+  CAF_CHECK_EQUAL(c.value(), 0);
+  CAF_MESSAGE("counters are incrementable");
+  c.inc();
+  c.inc(2);
+  CAF_CHECK_EQUAL(c.value(), 3);
+  CAF_MESSAGE("users can create counters with custom start values");
+  CAF_CHECK_EQUAL(telemetry::sharded_int_counter{42}.value(), 42);
+}
+
+CAF_TEST(sharded integer counters sum up the updates of all threads) {
+  telemetry::sharded_int_counter c;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+    threads.emplace_back([&c] {
+      for (int j = 0; j < 1000; ++j)
+        c.inc();
+    });
+  for (auto& t : threads)
+    t.join();
+  CAF_CHECK_EQUAL(c.value(), 4000);
+}
@@ -22,6 +22,8 @@
 
 #include "caf/test/dsl.hpp"
 
+#include "caf/telemetry/sharded_int_gauge.hpp"
+
 using namespace caf;
 
 CAF_TEST(double gauges can increment and decrement) {
@@ -62,3 +64,19 @@ CAF_TEST(integer gauges can increment and decrement) {
   CAF_MESSAGE("users can create gauges with custom start values");
   CAF_CHECK_EQUAL(telemetry::int_gauge{42}.value(), 42);
 }
+
+CAF_TEST(sharded integer gauges can increment and decrement) {
+  telemetry::sharded_int_gauge g;
+  CAF_MESSAGE("gauges start at 0");
+  CAF_CHECK_EQUAL(g.value(), 0);
+  CAF_MESSAGE("gauges are incrementable");
+  g.inc();
+  g.inc(2);
+  CAF_CHECK_EQUAL(g.value(), 3);
+  CAF_MESSAGE("gauges are decrementable");
+  g.dec();
+  g.dec(5);
+  CAF_CHECK_EQUAL(g.value(), -3);
+  CAF_MESSAGE("users can create gauges with custom start values");
+  CAF_CHECK_EQUAL(telemetry::sharded_int_gauge{42}.value(), 42);
+}
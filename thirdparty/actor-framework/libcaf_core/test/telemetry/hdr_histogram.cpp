@@ -0,0 +1,98 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE telemetry.hdr_histogram
+
+#include "caf/telemetry/hdr_histogram.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+using namespace caf::telemetry;
+
+CAF_TEST(hdr histograms map values outside of the range to the outer buckets) {
+  using limits = std::numeric_limits<double>;
+  auto last = hdr_histogram::num_buckets - 1;
+  CAF_CHECK_EQUAL(hdr_histogram::bucket_index(0.), 0u);
+  CAF_CHECK_EQUAL(hdr_histogram::bucket_index(-1.), 0u);
+  CAF_CHECK_EQUAL(hdr_histogram::bucket_index(limits::quiet_NaN()), 0u);
+  CAF_CHECK_EQUAL(hdr_histogram::bucket_index(hdr_histogram::min_value()), 1u);
+  CAF_CHECK_EQUAL(hdr_histogram::bucket_index(hdr_histogram::max_value()),
+                  last);
+  CAF_CHECK_EQUAL(hdr_histogram::bucket_index(limits::infinity()), last);
+  CAF_CHECK(std::isinf(hdr_histogram::upper_bound(last)));
+}
+
+CAF_TEST(hdr histogram buckets have a bounded relative error) {
+  for (size_t index = 1; index < hdr_histogram::num_buckets - 1; ++index) {
+    auto lower = hdr_histogram::upper_bound(index - 1);
+    auto upper = hdr_histogram::upper_bound(index);
+    CAF_REQUIRE_LESS(lower, upper);
+    CAF_REQUIRE_EQUAL(hdr_histogram::bucket_index(lower), index);
+    CAF_REQUIRE_EQUAL(hdr_histogram::bucket_index(std::nextafter(upper, 0.)),
+                      index);
+    CAF_REQUIRE_LESS_OR_EQUAL((upper - lower) / lower,
+                              1. / hdr_histogram::sub_buckets);
+  }
+}
+
+CAF_TEST(hdr histograms keep a count and a sum) {
+  hdr_histogram h;
+  CAF_CHECK_EQUAL(h.count(), 0);
+  CAF_CHECK_EQUAL(h.sum(), 0.);
+  CAF_CHECK_EQUAL(h.quantile(.5), 0.);
+  h.observe(1.);
+  h.observe(2.);
+  h.observe(4.);
+  CAF_CHECK_EQUAL(h.count(), 3);
+  CAF_CHECK_EQUAL(h.sum(), 7.);
+}
+
+CAF_TEST(hdr histograms compute quantiles) {
+  hdr_histogram h;
+  // Observe 1ms, 2ms, ..., 1000ms.
+  for (int i = 1; i <= 1000; ++i)
+    h.observe(i / 1000.);
+  auto near = [](double x, double expected) {
+    return x >= expected && x <= expected * (1. + 1. / 8);
+  };
+  CAF_CHECK(near(h.quantile(.5), .5));
+  CAF_CHECK(near(h.quantile(.99), .99));
+  CAF_CHECK(near(h.quantile(.999), .999));
+  CAF_CHECK(near(h.quantile(1.), 1.));
+}
+
+CAF_TEST(hdr histograms support concurrent observers) {
+  hdr_histogram h;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+    threads.emplace_back([&h] {
+      for (int j = 0; j < 1000; ++j)
+        h.observe(.25);
+    });
+  for (auto& t : threads)
+    t.join();
+  CAF_CHECK_EQUAL(h.count(), 4000);
+  CAF_CHECK_EQUAL(h.sum(), 1000.);
+  CAF_CHECK_EQUAL(h.bucket_counts()[hdr_histogram::bucket_index(.25)], 4000);
+}
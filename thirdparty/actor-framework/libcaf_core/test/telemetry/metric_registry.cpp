@@ -27,6 +27,8 @@
 #include "caf/telemetry/gauge.hpp"
 #include "caf/telemetry/label_view.hpp"
 #include "caf/telemetry/metric_type.hpp"
+#include "caf/telemetry/sharded_int_counter.hpp"
+#include "caf/telemetry/sharded_int_gauge.hpp"
 
 using namespace caf;
 using namespace caf::telemetry;
@@ -55,6 +57,18 @@ struct test_collector {
     result += std::to_string(wrapped->value());
   }
 
+  void operator()(const metric_family* family, const metric* instance,
+                  const sharded_int_counter* wrapped) {
+    concat(family, instance);
+    result += std::to_string(wrapped->value());
+  }
+
+  void operator()(const metric_family* family, const metric* instance,
+                  const sharded_int_gauge* wrapped) {
+    concat(family, instance);
+    result += std::to_string(wrapped->value());
+  }
+
   template <class T>
   void operator()(const metric_family* family, const metric* instance,
                   const histogram<T>* wrapped) {
@@ -62,6 +76,12 @@ struct test_collector {
     result += std::to_string(wrapped->sum());
   }
 
+  void operator()(const metric_family* family, const metric* instance,
+                  const hdr_histogram* wrapped) {
+    concat(family, instance);
+    result += std::to_string(wrapped->sum());
+  }
+
   void concat(const metric_family* family, const metric* instance) {
     result += '\n';
     result += family->prefix();
@@ -207,6 +227,23 @@ CAF_TEST(counter_instance is a shortcut for using the family manually) {
   CAF_CHECK_EQUAL(count, count2);
 }
 
+CAF_TEST(registries support sharded counters and gauges) {
+  auto msgs = registry.sharded_counter_singleton("caf", "processed-messages",
+                                                 "Number of messages.", "1",
+                                                 true);
+  auto queued = registry.sharded_gauge_family("caf", "queued-messages",
+                                              {"name"}, "Queued messages.");
+  CAF_CHECK_EQUAL(msgs, registry.sharded_counter_singleton(
+                          "caf", "processed-messages", "", "1", true));
+  msgs->inc(10);
+  queued->get_or_add({{"name", "foo"}})->inc(3);
+  queued->get_or_add({{"name", "foo"}})->dec();
+  registry.collect(collector);
+  CAF_CHECK_EQUAL(collector.result, R"(
+caf.processed-messages.total 10
+caf.queued-messages{name="foo"} 2)");
+}
+
 CAF_TEST_FIXTURE_SCOPE_END()
 
 #define CHECK_CONTAINS(str)                                                    \
@@ -224,3 +261,64 @@ CAF_TEST(enabling actor metrics per config creates metric instances) {
   CHECK_CONTAINS(R"(caf.actor.mailbox-size{name="caf.system.spawn-server"})");
   CHECK_CONTAINS(R"(caf.actor.mailbox-size{name="caf.system.config-server"})");
 }
+
+namespace {
+
+struct sampled_state {
+  static inline const char* name = "test.sampled";
+};
+
+} // namespace
+
+CAF_TEST(actors may sample their timing metrics) {
+  actor_system_config cfg;
+  test_coordinator_fixture<>::init_config(cfg);
+  put(cfg.content, "caf.metrics-filters.actors.includes",
+      std::vector<std::string>{"test.*"});
+  put(cfg.content, "caf.metrics-filters.actors.sample-interval", 4);
+  put(cfg.content, "caf.metrics-filters.actors.tsc-clock", true);
+  actor_system sys{cfg};
+  auto& sched = static_cast<scheduler::test_coordinator&>(sys.scheduler());
+  auto aut = sys.spawn([](stateful_actor<sampled_state>*) -> behavior {
+    return {
+      [](int32_t) {
+        // nop
+      },
+    };
+  });
+  for (int32_t i = 0; i < 8; ++i)
+    anon_send(aut, i);
+  sched.run();
+  const auto& families = sys.actor_metric_families();
+  auto lbl = label_view{"name", "test.sampled"};
+  auto size = families.mailbox_size->get_or_add({lbl});
+  CAF_CHECK_EQUAL(size->value(), 0);
+  auto processing_time = families.processing_time->get_or_add({lbl});
+  int64_t samples = 0;
+  for (const auto& bucket : processing_time->buckets())
+    samples += bucket.count.value();
+  CAF_CHECK_EQUAL(samples, 2);
+  anon_send_exit(aut, exit_reason::user_shutdown);
+  sched.run();
+}
+
+CAF_TEST(actors may use HDR histograms for their timing metrics) {
+  actor_system_config cfg;
+  test_coordinator_fixture<>::init_config(cfg);
+  put(cfg.content, "caf.metrics-filters.actors.includes",
+      std::vector<std::string>{"caf.system.*"});
+  put(cfg.content, "caf.metrics-filters.actors.hdr-histograms", true);
+  actor_system sys{cfg};
+  const auto& families = sys.actor_metric_families();
+  CAF_CHECK_EQUAL(families.processing_time, nullptr);
+  CAF_CHECK_EQUAL(families.mailbox_time, nullptr);
+  CAF_CHECK_NOT_EQUAL(families.hdr_processing_time, nullptr);
+  CAF_CHECK_NOT_EQUAL(families.hdr_mailbox_time, nullptr);
+  test_collector collector;
+  sys.metrics().collect(collector);
+  auto npos = std::string::npos;
+  CHECK_CONTAINS(
+    R"(caf.actor.processing-time.seconds{name="caf.system.spawn-server"})");
+  CHECK_CONTAINS(
+    R"(caf.actor.mailbox-time.seconds{name="caf.system.spawn-server"})");
+}
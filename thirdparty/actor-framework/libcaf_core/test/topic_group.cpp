@@ -0,0 +1,114 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2020 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#define CAF_SUITE topic_group
+
+#include "caf/all.hpp"
+
+#include "core-test.hpp"
+
+using namespace caf;
+
+namespace {
+
+behavior counter(event_based_actor* self, std::shared_ptr<int> count) {
+  return {
+    [=](int x) { *count += x; },
+  };
+}
+
+struct fixture : test_coordinator_fixture<> {
+  group topic(const std::string& name) {
+    auto grp = sys.groups().get("topic", name);
+    CAF_REQUIRE(grp);
+    return std::move(*grp);
+  }
+
+  std::shared_ptr<int> subscribe(const std::string& filter) {
+    auto count = std::make_shared<int>(0);
+    subscribers.emplace_back(sys.spawn_in_group(topic(filter), counter, count));
+    return count;
+  }
+
+  ~fixture() {
+    for (auto& x : subscribers)
+      anon_send_exit(x, exit_reason::user_shutdown);
+    run();
+  }
+
+  std::vector<actor> subscribers;
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(topic_group_tests, fixture)
+
+CAF_TEST(the topic module rejects invalid filters) {
+  CAF_CHECK(sys.groups().get("topic", "sensors/+/temp"));
+  CAF_CHECK_EQUAL(sys.groups().get("topic", "sensors/#/temp").error(),
+                  sec::invalid_argument);
+  CAF_CHECK_EQUAL(sys.groups().get("topic", "").error(),
+                  sec::invalid_argument);
+}
+
+CAF_TEST(topic groups are singletons) {
+  CAF_CHECK_EQUAL(topic("sensors/1/temp"), topic("sensors/1/temp"));
+  CAF_CHECK_NOT_EQUAL(topic("sensors/1/temp"), topic("sensors/+/temp"));
+  CAF_CHECK_EQUAL(to_string(topic("sensors/#")), "topic:sensors/#");
+}
+
+CAF_TEST(sending to a topic reaches all matching subscriptions) {
+  auto exact = subscribe("sensors/1/temp");
+  auto any_sensor = subscribe("sensors/+/temp");
+  auto everything = subscribe("sensors/#");
+  auto other = subscribe("actuators/#");
+  run();
+  self->send(topic("sensors/1/temp"), 1);
+  self->send(topic("sensors/2/temp"), 10);
+  self->send(topic("sensors"), 100);
+  self->send(topic("actuators/1"), 1000);
+  run();
+  CAF_CHECK_EQUAL(*exact, 1);
+  CAF_CHECK_EQUAL(*any_sensor, 11);
+  CAF_CHECK_EQUAL(*everything, 111);
+  CAF_CHECK_EQUAL(*other, 1000);
+  CAF_MESSAGE("new subscriptions invalidate cached matches");
+  auto late = subscribe("sensors/+/temp");
+  auto later = subscribe("+/2/temp");
+  run();
+  self->send(topic("sensors/2/temp"), 10);
+  run();
+  CAF_CHECK_EQUAL(*any_sensor, 21);
+  CAF_CHECK_EQUAL(*late, 10);
+  CAF_CHECK_EQUAL(*later, 10);
+}
+
+CAF_TEST(sending to a filter only reaches its own subscribers) {
+  auto exact = subscribe("sensors/1/temp");
+  auto any_sensor = subscribe("sensors/+/temp");
+  auto everything = subscribe("sensors/#");
+  run();
+  self->send(topic("sensors/+/temp"), 1);
+  run();
+  CAF_CHECK_EQUAL(*exact, 0);
+  CAF_CHECK_EQUAL(*any_sensor, 1);
+  CAF_CHECK_EQUAL(*everything, 0);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -0,0 +1,126 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#define CAF_SUITE trace_profiler
+
+#include "caf/trace_profiler.hpp"
+
+#include "core-test.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace caf;
+
+namespace {
+
+struct alice_state {
+  static inline const char* name = "alice";
+};
+
+struct bob_state {
+  static inline const char* name = "bob";
+};
+
+struct fixture : test_coordinator_fixture<> {
+  fixture() : file_name("caf-trace-test.bin") {
+    // nop
+  }
+
+  ~fixture() {
+    std::remove(file_name.c_str());
+  }
+
+  std::string convert() {
+    std::ifstream in{file_name, std::ios::binary};
+    std::ostringstream out;
+    if (auto err = trace_profiler::convert_to_json(in, out))
+      CAF_FAIL("conversion failed: " << err);
+    return out.str();
+  }
+
+  bool contains(const std::string& str, const std::string& what) {
+    return str.find(what) != std::string::npos;
+  }
+
+  std::string file_name;
+};
+
+behavior dummy() {
+  return {
+    [](int) {},
+  };
+}
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(trace_profiler_tests, fixture)
+
+CAF_TEST(the trace profiler drops events until opening a file) {
+  trace_profiler prof;
+  CAF_CHECK(!prof.recording());
+  auto hdl = sys.spawn([](stateful_actor<alice_state>*) { return dummy(); });
+  prof.add_actor(deref(hdl), nullptr);
+  CAF_CHECK_EQUAL(prof.open("/does/not/exist/trace.bin"),
+                  sec::cannot_open_file);
+  CAF_CHECK(!prof.recording());
+}
+
+CAF_TEST(the trace profiler converts message flows to trace events) {
+  auto alice = sys.spawn([](stateful_actor<alice_state>*) { return dummy(); });
+  auto bob = sys.spawn([](stateful_actor<bob_state>*) { return dummy(); });
+  auto& alice_ref = deref(alice);
+  auto& bob_ref = deref(bob);
+  { // Lifetime scope of the profiler.
+    trace_profiler prof;
+    CAF_REQUIRE_EQUAL(prof.open(file_name), none);
+    CAF_CHECK(prof.recording());
+    prof.add_actor(alice_ref, nullptr);
+    prof.add_actor(bob_ref, &alice_ref);
+    auto element = make_mailbox_element(nullptr, make_message_id(), {},
+                                        make_message(42));
+    prof.before_sending(alice_ref, *element);
+    prof.before_processing(bob_ref, *element);
+    prof.after_processing(bob_ref, invoke_message_result::consumed);
+    prof.remove_actor(bob_ref);
+  }
+  auto json = convert();
+  CAF_MESSAGE("trace: " << json);
+  auto alice_name = "\"alice#" + std::to_string(alice.id()) + '"';
+  auto bob_name = "\"bob#" + std::to_string(bob.id()) + '"';
+  CAF_CHECK(contains(json, R"({"displayTimeUnit":"ns","traceEvents":[)"));
+  CAF_CHECK(contains(json, R"("name":"spawn","args":{"actor":)" + bob_name
+                             + R"(,"parent":)" + alice_name + "}}"));
+  CAF_CHECK(contains(json, R"("cat":"message","name":"message","id":1})"));
+  CAF_CHECK(contains(json, R"("cat":"processing","name":)" + bob_name
+                             + R"(,"args":{"result":"consumed","mailbox_time_us":)"));
+  CAF_CHECK(contains(json, R"("bp":"e","cat":"message","name":"message","id":1})"));
+  CAF_CHECK(contains(json, R"("name":"remove","args":{"actor":)" + bob_name));
+  CAF_CHECK(contains(json, R"("name":"thread_name")"));
+}
+
+CAF_TEST(the trace profiler rejects unknown input) {
+  std::istringstream in{"not a trace file at all"};
+  std::ostringstream out;
+  CAF_CHECK_EQUAL(trace_profiler::convert_to_json(in, out),
+                  sec::invalid_argument);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -0,0 +1,174 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#define CAF_SUITE tracer
+
+#include "caf/tracer.hpp"
+
+#include "core-test.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+using namespace caf;
+
+namespace {
+
+constexpr const char* output_file = "caf-tracer-test.json";
+
+struct config : actor_system_config {
+  config() {
+    set("caf.tracing.sample-rate", 1.0);
+    set("caf.tracing.output", output_file);
+    set("caf.tracing.service-name", "tracer-test");
+  }
+};
+
+struct fixture : test_coordinator_fixture<config> {
+  ~fixture() {
+    std::remove(output_file);
+  }
+
+  std::string read_output() {
+    sys.tracer()->flush();
+    std::ifstream in{output_file};
+    return std::string{std::istreambuf_iterator<char>{in},
+                       std::istreambuf_iterator<char>{}};
+  }
+};
+
+struct bob_state {
+  trace_context trace;
+  static inline const char* name = "bob";
+};
+
+behavior bob_impl(stateful_actor<bob_state>* self) {
+  return {
+    [=](int32_t) {
+      self->state.trace = self->current_mailbox_element()->trace;
+    },
+  };
+}
+
+struct alice_state {
+  trace_context trace;
+  static inline const char* name = "alice";
+};
+
+behavior alice_impl(stateful_actor<alice_state>* self, actor bob) {
+  return {
+    [=](int32_t x) {
+      self->state.trace = self->current_mailbox_element()->trace;
+      self->send(bob, x);
+    },
+  };
+}
+
+} // namespace
+
+CAF_TEST(trace contexts convert to and from traceparent headers) {
+  auto ctx = trace_context::make_root(trace_context::sampled_flag);
+  CAF_CHECK(ctx.valid());
+  CAF_CHECK(ctx.sampled());
+  auto str = ctx.to_traceparent();
+  CAF_CHECK_EQUAL(str.size(), 55u);
+  CAF_CHECK_EQUAL(str.compare(0, 3, "00-"), 0);
+  CAF_CHECK_EQUAL(str.substr(3, 32), ctx.trace_id_hex());
+  CAF_CHECK_EQUAL(str.substr(36, 16), to_hex_span_id(ctx.span_id));
+  CAF_CHECK_EQUAL(str.substr(53), "01");
+  if (auto child = trace_context::from_traceparent(str); CAF_CHECK(child)) {
+    CAF_CHECK_EQUAL(child->trace_id_high, ctx.trace_id_high);
+    CAF_CHECK_EQUAL(child->trace_id_low, ctx.trace_id_low);
+    CAF_CHECK_EQUAL(child->parent_span_id, ctx.span_id);
+    CAF_CHECK_NOT_EQUAL(child->span_id, ctx.span_id);
+    CAF_CHECK(child->sampled());
+  }
+  CAF_MESSAGE("the parser rejects malformed input");
+  std::string valid
+    = "00-0af7651916cd43dd8448eb211c80319c-b7ad6b7169203331-01";
+  CAF_CHECK(trace_context::from_traceparent(valid));
+  CAF_CHECK(!trace_context::from_traceparent(valid.substr(1)));
+  std::string zero_id
+    = "00-00000000000000000000000000000000-b7ad6b7169203331-01";
+  CAF_CHECK(!trace_context::from_traceparent(zero_id));
+  std::string bad_version
+    = "ff-0af7651916cd43dd8448eb211c80319c-b7ad6b7169203331-01";
+  CAF_CHECK(!trace_context::from_traceparent(bad_version));
+  std::string upper_case
+    = "00-0AF7651916CD43DD8448EB211C80319C-b7ad6b7169203331-01";
+  CAF_CHECK(!trace_context::from_traceparent(upper_case));
+}
+
+CAF_TEST(the tracer makes head-based sampling decisions) {
+  mailbox_element element;
+  CAF_MESSAGE("a sample rate of 0 never starts a trace");
+  tracer never{0.0, "", "test"};
+  for (int i = 0; i < 100; ++i)
+    tracer::propagate(&never, nullptr, element);
+  CAF_CHECK(!element.trace.valid());
+  CAF_CHECK(!element.trace.sampled());
+  CAF_MESSAGE("a sample rate of 1 always starts a trace");
+  tracer always{1.0, "", "test"};
+  tracer::propagate(&always, nullptr, element);
+  CAF_CHECK(element.trace.valid());
+  CAF_CHECK(element.trace.sampled());
+  CAF_CHECK_EQUAL(element.trace.parent_span_id, 0u);
+  CAF_MESSAGE("children of sampled messages inherit the trace");
+  mailbox_element child;
+  tracer::propagate(nullptr, &element, child);
+  CAF_CHECK_EQUAL(child.trace.trace_id_high, element.trace.trace_id_high);
+  CAF_CHECK_EQUAL(child.trace.trace_id_low, element.trace.trace_id_low);
+  CAF_CHECK_EQUAL(child.trace.parent_span_id, element.trace.span_id);
+  CAF_CHECK(child.trace.sampled());
+}
+
+CAF_TEST_FIXTURE_SCOPE(tracer_tests, fixture)
+
+CAF_TEST(actors propagate trace contexts and record spans) {
+  auto bob = sys.spawn(bob_impl);
+  auto alice = sys.spawn(alice_impl, bob);
+  run();
+  self->send(alice, int32_t{42});
+  run();
+  auto& alice_trace = deref<stateful_actor<alice_state>>(alice).state.trace;
+  auto& bob_trace = deref<stateful_actor<bob_state>>(bob).state.trace;
+  CAF_REQUIRE(alice_trace.sampled());
+  CAF_REQUIRE(bob_trace.sampled());
+  CAF_CHECK_EQUAL(alice_trace.parent_span_id, 0u);
+  CAF_CHECK_EQUAL(bob_trace.trace_id_high, alice_trace.trace_id_high);
+  CAF_CHECK_EQUAL(bob_trace.trace_id_low, alice_trace.trace_id_low);
+  CAF_CHECK_EQUAL(bob_trace.parent_span_id, alice_trace.span_id);
+  CAF_CHECK_EQUAL(sys.tracer()->recorded_spans(), 2u);
+  CAF_MESSAGE("the tracer writes spans as OTLP JSON");
+  auto str = read_output();
+  auto contains = [&str](const std::string& what) {
+    return str.find(what) != std::string::npos;
+  };
+  CAF_CHECK_EQUAL(str.compare(0, 17, R"({"resourceSpans":)"), 0);
+  CAF_CHECK(contains(R"({"stringValue":"tracer-test"})"));
+  CAF_CHECK(contains(R"("traceId":")" + alice_trace.trace_id_hex() + '"'));
+  CAF_CHECK(contains(R"("spanId":")" + to_hex_span_id(alice_trace.span_id)));
+  CAF_CHECK(contains(R"("parentSpanId":")"
+                     + to_hex_span_id(alice_trace.span_id)));
+  CAF_CHECK(contains(R"("name":"alice")"));
+  CAF_CHECK(contains(R"("name":"bob")"));
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -22,6 +22,8 @@
 
 #include "core-test.hpp"
 
+#include "caf/detail/type_id_list_builder.hpp"
+
 using namespace caf;
 
 CAF_TEST(lists store the size at index 0) {
@@ -35,11 +37,12 @@ CAF_TEST(lists store the size at index 0) {
 
 CAF_TEST(lists are comparable) {
   type_id_t data[] = {3, 1, 2, 4};
-  type_id_list xs{data};
+  type_id_list xs{detail::intern_type_id_list(data)};
   type_id_t data_copy[] = {3, 1, 2, 4};
-  type_id_list ys{data_copy};
+  type_id_list ys{detail::intern_type_id_list(data_copy)};
   CAF_CHECK_EQUAL(xs, ys);
   data_copy[1] = 10;
+  ys = type_id_list{detail::intern_type_id_list(data_copy)};
   CAF_CHECK_NOT_EQUAL(xs, ys);
   CAF_CHECK_LESS(xs, ys);
   CAF_CHECK_EQUAL(make_type_id_list<add_atom>(), make_type_id_list<add_atom>());
@@ -47,6 +50,22 @@ CAF_TEST(lists are comparable) {
                       make_type_id_list<ok_atom>());
 }
 
+CAF_TEST(equal lists share the same storage) {
+  type_id_t data[] = {2, type_id_v<uint8_t>, type_id_v<bool>};
+  auto xs = make_type_id_list<uint8_t, bool>();
+  auto ys = type_id_list{detail::intern_type_id_list(data)};
+  detail::type_id_list_builder builder;
+  builder.push_back(type_id_v<uint8_t>);
+  builder.push_back(type_id_v<bool>);
+  auto zs = builder.copy_to_list();
+  CAF_CHECK(xs.data() == ys.data());
+  CAF_CHECK(xs.data() == zs.data());
+  CAF_CHECK(xs.data() != data);
+  CAF_CHECK_EQUAL(xs.hash(), zs.hash());
+  CAF_CHECK_EQUAL(std::hash<type_id_list>{}(xs), xs.hash());
+  CAF_CHECK_EQUAL(builder.move_to_list(), xs);
+}
+
 CAF_TEST(make_type_id_list constructs a list from types) {
   auto xs = make_type_id_list<uint8_t, bool, float>();
   CAF_CHECK_EQUAL(xs.size(), 3u);
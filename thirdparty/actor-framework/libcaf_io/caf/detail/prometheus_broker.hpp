@@ -22,15 +22,17 @@
 #include <unordered_map>
 #include <vector>
 
+#include "caf/actor.hpp"
 #include "caf/byte_buffer.hpp"
 #include "caf/detail/io_export.hpp"
 #include "caf/fwd.hpp"
 #include "caf/io/broker.hpp"
-#include "caf/telemetry/collector/prometheus.hpp"
 
 namespace caf::detail {
 
-/// Makes system metrics in the Prometheus format available via HTTP 1.1.
+/// Makes system metrics in the Prometheus format available via HTTP 1.1. The
+/// broker delegates rendering the metrics to a helper actor in order to keep
+/// the I/O loop responsive while scraping large registries.
 class CAF_IO_EXPORT prometheus_broker : public io::broker {
 public:
   explicit prometheus_broker(actor_config& cfg);
@@ -49,7 +51,7 @@ private:
   void scrape();
 
   std::unordered_map<io::connection_handle, byte_buffer> requests_;
-  telemetry::collector::prometheus collector_;
+  actor renderer_;
   time_t last_scrape_ = 0;
   telemetry::dbl_gauge* cpu_time_ = nullptr;
   telemetry::int_gauge* mem_size_ = nullptr;
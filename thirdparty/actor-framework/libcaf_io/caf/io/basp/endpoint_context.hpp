@@ -28,6 +28,7 @@
 
 #include "caf/io/basp/connection_state.hpp"
 #include "caf/io/basp/header.hpp"
+#include "caf/io/basp/peer_metrics.hpp"
 
 namespace caf::io::basp {
 
@@ -46,6 +47,10 @@ struct endpoint_context {
   uint16_t local_port;
   // pending operations to be performed after handshake completed
   optional<response_promise> callback;
+  // metric instances for the remote node, enabled after the handshake
+  basp::peer_metrics metrics;
+  // size of the write buffer before writing the current batch of data
+  optional<size_t> wr_mark;
 };
 
 } // namespace caf::io::basp
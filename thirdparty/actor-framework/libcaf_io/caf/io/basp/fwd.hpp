@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <memory>
+
 namespace caf::io::basp {
 
 struct header;
@@ -28,4 +30,6 @@ class message_queue;
 class instance;
 class routing_table;
 
+using message_queue_ptr = std::shared_ptr<message_queue>;
+
 } // namespace caf::io::basp
@@ -63,6 +63,9 @@ struct header {
   /// Identifies a receiver by name rather than ID.
   static const uint8_t named_receiver_flag = 0x01;
 
+  /// Signals that the payload starts with a @ref trace_context.
+  static const uint8_t trace_context_flag = 0x02;
+
   /// Identifies the config server.
   static const uint64_t config_server_id = 1;
 
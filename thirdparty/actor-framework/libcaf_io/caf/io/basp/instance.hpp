@@ -19,6 +19,7 @@
 #pragma once
 
 #include <limits>
+#include <unordered_map>
 
 #include "caf/actor_system_config.hpp"
 #include "caf/byte_buffer.hpp"
@@ -30,6 +31,7 @@
 #include "caf/io/basp/header.hpp"
 #include "caf/io/basp/message_queue.hpp"
 #include "caf/io/basp/message_type.hpp"
+#include "caf/io/basp/peer_metrics.hpp"
 #include "caf/io/basp/routing_table.hpp"
 #include "caf/io/basp/worker.hpp"
 #include "caf/io/middleman.hpp"
@@ -101,6 +103,10 @@ public:
     /// Returns a handle to the callee actor.
     virtual strong_actor_ptr this_actor() = 0;
 
+    /// Returns the metric instances for the node connected via `hdl` or
+    /// `nullptr` if the callee collects no metrics for this connection.
+    virtual peer_metrics* metrics(connection_handle hdl);
+
   protected:
     proxy_registry namespace_;
   };
@@ -147,11 +153,14 @@ public:
   size_t remove_published_actor(const actor_addr& whom, uint16_t port,
                                 removed_published_actor* cb = nullptr);
 
-  /// Returns `true` if a path to destination existed, `false` otherwise.
+  /// Returns `true` if a path to destination existed, `false` otherwise. If
+  /// `trace` belongs to a sampled trace, the remote receiver records its span
+  /// as a child of `trace`.
   bool dispatch(execution_unit* ctx, const strong_actor_ptr& sender,
                 const std::vector<strong_actor_ptr>& forwarding_stack,
                 const node_id& dest_node, uint64_t dest_actor, uint8_t flags,
-                message_id mid, const message& msg);
+                message_id mid, const message& msg,
+                const trace_context* trace = nullptr);
 
   /// Returns the actor namespace associated to this BASP protocol instance.
   proxy_registry& proxies() {
@@ -210,8 +219,23 @@ public:
     return hub_;
   }
 
-  message_queue& queue() {
-    return queue_;
+  /// Returns the queue for establishing strict ordering of messages that
+  /// arrive via `last_hop`, creating it on demand. Messages without a known
+  /// peer use the queue for `none`.
+  message_queue& queue(const node_id& last_hop = node_id{}) {
+    return *queue_ptr(last_hop);
+  }
+
+  /// Returns a shared handle to the queue for `last_hop`.
+  const message_queue_ptr& queue_ptr(const node_id& last_hop);
+
+  /// Drops the queue for `last_hop`. Workers that still deserialize messages
+  /// from this peer keep the queue alive until they are done.
+  void erase_queue(const node_id& last_hop);
+
+  /// Returns the number of deserialization workers that the hub owns.
+  size_t num_workers() const noexcept {
+    return num_workers_;
   }
 
   actor_system& system() {
@@ -233,8 +257,10 @@ private:
   published_actor_map published_actors_;
   node_id this_node_;
   callee& callee_;
-  message_queue queue_;
+  std::unordered_map<node_id, message_queue_ptr> queues_;
   detail::worker_hub<worker> hub_;
+  size_t num_workers_;
+  size_t max_workers_;
 };
 
 /// @}
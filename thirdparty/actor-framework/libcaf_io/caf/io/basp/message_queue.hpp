@@ -30,7 +30,9 @@
 namespace caf::io::basp {
 
 /// Enforces strict order of message delivery, i.e., deliver messages in the
-/// same order as if they were deserialized by a single thread.
+/// same order as if they were deserialized by a single thread. The BASP
+/// instance keeps one queue per peer, i.e., ordering is guaranteed per
+/// connection and workers for different peers never contend on this lock.
 class CAF_IO_EXPORT message_queue {
 public:
   // -- member types -----------------------------------------------------------
@@ -71,7 +73,7 @@ public:
   uint64_t next_undelivered;
 
   /// Keeps messages in sorted order in case a message other than
-  /// `next_undelivered` gets ready first.
+  /// `next_undelivered` gets ready first. Sorted by `id` in ascending order.
   std::vector<actor_msg> pending;
 };
 
@@ -0,0 +1,79 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <chrono>
+
+#include "caf/detail/io_export.hpp"
+#include "caf/fwd.hpp"
+#include "caf/telemetry/counter.hpp"
+#include "caf/telemetry/gauge.hpp"
+#include "caf/telemetry/hdr_histogram.hpp"
+
+namespace caf::io::basp {
+
+/// @addtogroup BASP
+/// @{
+
+/// Bundles the metric instances for a single remote node, i.e., the instances
+/// of all `caf.middleman` metric families that carry the ID of the node as
+/// `node` label.
+struct CAF_IO_EXPORT peer_metrics {
+  /// Counts the bytes received from the node.
+  telemetry::int_counter* inbound_bytes = nullptr;
+
+  /// Counts the bytes sent to the node.
+  telemetry::int_counter* outbound_bytes = nullptr;
+
+  /// Counts the actor messages received from the node.
+  telemetry::int_counter* inbound_messages = nullptr;
+
+  /// Counts the actor messages sent to the node.
+  telemetry::int_counter* outbound_messages = nullptr;
+
+  /// Tracks how many bytes wait in the output buffer of the connection, i.e.,
+  /// did not make it to the socket yet.
+  telemetry::int_gauge* pending_write_bytes = nullptr;
+
+  /// Samples how long BASP needs to serialize messages to the node.
+  telemetry::hdr_histogram* serialization_time = nullptr;
+
+  /// Samples how long BASP needs to deserialize messages from the node.
+  telemetry::hdr_histogram* deserialization_time = nullptr;
+
+  /// Samples the time between two heartbeats from the node.
+  telemetry::hdr_histogram* heartbeat_interval = nullptr;
+
+  /// Stores when the node sent its last heartbeat.
+  std::chrono::steady_clock::time_point last_heartbeat;
+
+  /// Returns whether this object points to valid metric instances.
+  bool enabled() const noexcept {
+    return inbound_bytes != nullptr;
+  }
+
+  /// Returns the metric instances for `nid`, creating them if necessary.
+  static peer_metrics make(telemetry::metric_registry& reg,
+                           const node_id& nid);
+};
+
+/// @}
+
+} // namespace caf::io::basp
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <vector>
 
 #include "caf/actor_control_block.hpp"
@@ -33,6 +34,8 @@
 #include "caf/message.hpp"
 #include "caf/message_id.hpp"
 #include "caf/node_id.hpp"
+#include "caf/trace_context.hpp"
+#include "caf/telemetry/hdr_histogram.hpp"
 
 namespace caf::io::basp {
 
@@ -103,7 +106,17 @@ public:
       srb(src, mid);
       return;
     }
+    // Get the trace context of sampled messages.
+    trace_context trace;
+    if (dref.hdr_.has(basp::header::trace_context_flag)
+        && !source.apply_object(trace)) {
+      CAF_LOG_ERROR("failed to read trace context:" << source.get_error());
+      return;
+    }
     // Get the remainder of the message.
+    using clock_type = std::chrono::steady_clock;
+    auto t0 = dref.deserialization_time_ != nullptr ? clock_type::now()
+                                                    : clock_type::time_point{};
     if (!source.apply_object(stages)) {
       CAF_LOG_ERROR("failed to read stages:" << source.get_error());
       return;
@@ -112,6 +125,11 @@ public:
       CAF_LOG_ERROR("failed to read message content:" << source.get_error());
       return;
     }
+    if (dref.deserialization_time_ != nullptr) {
+      using fractional_seconds = std::chrono::duration<double>;
+      auto delta = fractional_seconds{clock_type::now() - t0};
+      dref.deserialization_time_->observe(delta.count());
+    }
     // Intercept link messages. Forwarding actor proxies signalize linking
     // by sending link_atom/unlink_atom message with src == dest.
     if (auto view
@@ -134,9 +152,10 @@ public:
     }
     // Ship the message.
     guard.disable();
-    dref.queue_->push(ctx, dref.msg_id_, std::move(dst),
-                      make_mailbox_element(std::move(src), mid,
-                                           std::move(stages), std::move(msg)));
+    auto ptr = make_mailbox_element(std::move(src), mid, std::move(stages),
+                                    std::move(msg));
+    ptr->trace = trace;
+    dref.queue_->push(ctx, dref.msg_id_, std::move(dst), std::move(ptr));
   }
 };
 
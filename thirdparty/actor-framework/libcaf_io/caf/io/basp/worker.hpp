@@ -55,14 +55,18 @@ public:
   // -- constructors, destructors, and assignment operators --------------------
 
   /// Only the ::worker_hub has access to the constructor.
-  worker(hub_type& hub, message_queue& queue, proxy_registry& proxies);
+  worker(hub_type& hub, proxy_registry& proxies);
 
   ~worker() override;
 
   // -- management -------------------------------------------------------------
 
-  void launch(const node_id& last_hop, const basp::header& hdr,
-              const byte_buffer& payload);
+  /// Deserializes `payload` asynchronously and ships the result through
+  /// `queue`, which establishes strict ordering for messages from `last_hop`.
+  /// Samples the deserialization time if `deserialization_time != nullptr`.
+  void launch(message_queue_ptr queue, const node_id& last_hop,
+              const basp::header& hdr, const byte_buffer& payload,
+              telemetry::hdr_histogram* deserialization_time = nullptr);
 
   // -- implementation of resumable --------------------------------------------
 
@@ -73,8 +77,7 @@ private:
 
   /// Stores how many bytes the "first half" of this object requires.
   static constexpr size_t pointer_members_size
-    = sizeof(hub_type*) + sizeof(message_queue*) + sizeof(proxy_registry*)
-      + sizeof(actor_system*);
+    = sizeof(hub_type*) + sizeof(proxy_registry*) + sizeof(actor_system*);
 
   static_assert(CAF_CACHE_LINE_SIZE > pointer_members_size,
                 "invalid cache line size");
@@ -84,9 +87,6 @@ private:
   /// Points to our home hub.
   hub_type* hub_;
 
-  /// Points to the queue for establishing strict ordering.
-  message_queue* queue_;
-
   /// Points to our proxy registry / factory.
   proxy_registry* proxies_;
 
@@ -96,6 +96,9 @@ private:
   /// Prevents false sharing when writing to `next`.
   char pad_[CAF_CACHE_LINE_SIZE - pointer_members_size];
 
+  /// Points to the queue of `last_hop_` for establishing strict ordering.
+  message_queue_ptr queue_;
+
   /// ID for local ordering.
   uint64_t msg_id_;
 
@@ -108,6 +111,9 @@ private:
 
   /// Contains whatever this worker deserializes next.
   byte_buffer payload_;
+
+  /// Optionally samples how long the worker needs for deserializing.
+  telemetry::hdr_histogram* deserialization_time_ = nullptr;
 };
 
 } // namespace caf::io::basp
@@ -102,6 +102,8 @@ public:
 
   strong_actor_ptr this_actor() override;
 
+  basp::peer_metrics* metrics(connection_handle hdl) override;
+
   // -- utility functions ------------------------------------------------------
 
   /// Sends `node_down_msg` to all registered observers.
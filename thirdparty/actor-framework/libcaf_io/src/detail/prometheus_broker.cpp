@@ -18,9 +18,12 @@
 
 #include "caf/detail/prometheus_broker.hpp"
 
+#include "caf/event_based_actor.hpp"
 #include "caf/span.hpp"
+#include "caf/stateful_actor.hpp"
 #include "caf/string_algorithms.hpp"
 #include "caf/string_view.hpp"
+#include "caf/telemetry/collector/prometheus.hpp"
 #include "caf/telemetry/dbl_gauge.hpp"
 #include "caf/telemetry/int_gauge.hpp"
 
@@ -185,6 +188,28 @@ constexpr string_view request_ok = "HTTP/1.1 200 OK\r\n"
                                    "Content-Type: text/plain\r\n"
                                    "Connection: Closed\r\n\r\n";
 
+struct prometheus_renderer_state {
+  telemetry::collector::prometheus collector;
+  static inline const char* name = "caf.system.prometheus-renderer";
+};
+
+// Renders the metrics of the actor system on a worker thread of the scheduler
+// and produces the full HTTP response for the broker.
+behavior prometheus_renderer(stateful_actor<prometheus_renderer_state>* self) {
+  return {
+    [self](get_atom) {
+      auto hdr = as_bytes(make_span(request_ok));
+      auto text = self->state.collector.collect_from(self->system().metrics());
+      auto payload = as_bytes(make_span(text));
+      byte_buffer result;
+      result.reserve(hdr.size() + payload.size());
+      result.insert(result.end(), hdr.begin(), hdr.end());
+      result.insert(result.end(), payload.begin(), payload.end());
+      return result;
+    },
+  };
+}
+
 } // namespace
 
 prometheus_broker::prometheus_broker(actor_config& cfg) : io::broker(cfg) {
@@ -223,6 +248,7 @@ bool prometheus_broker::has_process_metrics() noexcept {
 }
 
 behavior prometheus_broker::make_behavior() {
+  renderer_ = spawn<linked + hidden>(prometheus_renderer);
   return {
     [=](const io::new_data_msg& msg) {
       auto& req = requests_[msg.handle];
@@ -248,14 +274,16 @@ behavior prometheus_broker::make_behavior() {
       }
       // Collect metrics, ship response, and close.
       scrape();
-      auto hdr = as_bytes(make_span(request_ok));
-      auto text = collector_.collect_from(system().metrics());
-      auto payload = as_bytes(make_span(text));
-      auto& dst = wr_buf(msg.handle);
-      dst.insert(dst.end(), hdr.begin(), hdr.end());
-      dst.insert(dst.end(), payload.begin(), payload.end());
-      flush(msg.handle);
-      close(msg.handle);
+      auto hdl = msg.handle;
+      request(renderer_, infinite, get_atom_v)
+        .then(
+          [=](const byte_buffer& response) {
+            auto& dst = wr_buf(hdl);
+            dst.insert(dst.end(), response.begin(), response.end());
+            flush(hdl);
+            close(hdl);
+          },
+          [=](const error&) { close(hdl); });
     },
     [=](const io::new_connection_msg& msg) {
       // Pre-allocate buffer for maximum request size.
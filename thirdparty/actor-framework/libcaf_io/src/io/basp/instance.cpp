@@ -28,6 +28,7 @@
 #include "caf/io/basp/version.hpp"
 #include "caf/io/basp/worker.hpp"
 #include "caf/settings.hpp"
+#include "caf/trace_context.hpp"
 
 namespace caf::io::basp {
 
@@ -40,16 +41,38 @@ instance::callee::~callee() {
   // nop
 }
 
+peer_metrics* instance::callee::metrics(connection_handle) {
+  return nullptr;
+}
+
 instance::instance(abstract_broker* parent, callee& lstnr)
   : tbl_(parent), this_node_(parent->system().node()), callee_(lstnr) {
   CAF_ASSERT(this_node_ != none);
-  size_t workers;
-  if (auto workers_cfg = get_if<size_t>(&config(), "caf.middleman.workers"))
-    workers = *workers_cfg;
-  else
-    workers = std::min(3u, std::thread::hardware_concurrency() / 4u) + 1;
-  for (size_t i = 0; i < workers; ++i)
-    hub_.add_new_worker(queue_, proxies());
+  // Users that configure a fixed number of workers only get elastic scaling
+  // when also setting an upper bound explicitly.
+  if (auto workers_cfg = get_if<size_t>(&config(), "caf.middleman.workers")) {
+    num_workers_ = *workers_cfg;
+    max_workers_ = num_workers_;
+  } else {
+    num_workers_ = std::min(3u, std::thread::hardware_concurrency() / 4u) + 1;
+    max_workers_ = std::max(size_t{std::thread::hardware_concurrency()},
+                            num_workers_);
+  }
+  if (auto max_cfg = get_if<size_t>(&config(), "caf.middleman.max-workers"))
+    max_workers_ = std::max(*max_cfg, num_workers_);
+  for (size_t i = 0; i < num_workers_; ++i)
+    hub_.add_new_worker(proxies());
+}
+
+const message_queue_ptr& instance::queue_ptr(const node_id& last_hop) {
+  auto& ptr = queues_[last_hop];
+  if (ptr == nullptr)
+    ptr = std::make_shared<message_queue>();
+  return ptr;
+}
+
+void instance::erase_queue(const node_id& last_hop) {
+  queues_.erase(last_hop);
 }
 
 connection_state instance::handle(execution_unit* ctx, new_data_msg& dm,
@@ -167,7 +190,8 @@ size_t instance::remove_published_actor(const actor_addr& whom, uint16_t port,
 bool instance::dispatch(execution_unit* ctx, const strong_actor_ptr& sender,
                         const std::vector<strong_actor_ptr>& forwarding_stack,
                         const node_id& dest_node, uint64_t dest_actor,
-                        uint8_t flags, message_id mid, const message& msg) {
+                        uint8_t flags, message_id mid, const message& msg,
+                        const trace_context* trace) {
   CAF_LOG_TRACE(CAF_ARG(sender)
                 << CAF_ARG(dest_node) << CAF_ARG(mid) << CAF_ARG(msg));
   CAF_ASSERT(dest_node && this_node_ != dest_node);
@@ -175,6 +199,19 @@ bool instance::dispatch(execution_unit* ctx, const strong_actor_ptr& sender,
   if (!path)
     return false;
   auto& source_node = sender ? sender->node() : this_node_;
+  // Sampled messages carry the context for the span of the remote receiver.
+  trace_context remote_trace;
+  if (trace != nullptr && trace->sampled()) {
+    remote_trace = trace->make_child();
+    flags |= header::trace_context_flag;
+  }
+  auto write_trace = [&](binary_serializer& sink) {
+    return (flags & header::trace_context_flag) == 0
+           || sink.apply_object(remote_trace);
+  };
+  auto metrics = callee_.metrics(path->hdl);
+  auto t0 = metrics != nullptr ? std::chrono::steady_clock::now()
+                               : std::chrono::steady_clock::time_point{};
   if (dest_node == path->next_hop && source_node == this_node_) {
     header hdr{message_type::direct_message,
                flags,
@@ -183,7 +220,7 @@ bool instance::dispatch(execution_unit* ctx, const strong_actor_ptr& sender,
                sender ? sender->id() : invalid_actor_id,
                dest_actor};
     auto writer = make_callback([&](binary_serializer& sink) { //
-      return sink.apply_objects(forwarding_stack, msg);
+      return write_trace(sink) && sink.apply_objects(forwarding_stack, msg);
     });
     write(ctx, callee_.get_buffer(path->hdl), hdr, &writer);
   } else {
@@ -197,10 +234,17 @@ bool instance::dispatch(execution_unit* ctx, const strong_actor_ptr& sender,
       CAF_LOG_DEBUG("send routed message: "
                     << CAF_ARG(source_node) << CAF_ARG(dest_node)
                     << CAF_ARG(forwarding_stack) << CAF_ARG(msg));
-      return sink.apply_objects(source_node, dest_node, forwarding_stack, msg);
+      return sink.apply_objects(source_node, dest_node) && write_trace(sink)
+             && sink.apply_objects(forwarding_stack, msg);
     });
     write(ctx, callee_.get_buffer(path->hdl), hdr, &writer);
   }
+  if (metrics != nullptr) {
+    using fractional_seconds = std::chrono::duration<double>;
+    auto t1 = std::chrono::steady_clock::now();
+    metrics->serialization_time->observe(fractional_seconds{t1 - t0}.count());
+    metrics->outbound_messages->inc();
+  }
   flush(*path);
   return true;
 }
@@ -416,12 +460,26 @@ connection_state instance::handle(execution_unit* ctx, connection_handle hdl,
     }
     // fall through
     case message_type::direct_message: {
+      telemetry::hdr_histogram* deserialization_time = nullptr;
+      if (auto metrics = callee_.metrics(hdl)) {
+        metrics->inbound_messages->inc();
+        deserialization_time = metrics->deserialization_time;
+      }
       auto worker = hub_.pop();
+      if (worker == nullptr && num_workers_ < max_workers_) {
+        // All workers are busy, i.e., we have a backlog. Grow the hub instead
+        // of deserializing on the multiplexer thread.
+        CAF_LOG_DEBUG("add BASP worker" << CAF_ARG(num_workers_));
+        hub_.add_new_worker(proxies());
+        ++num_workers_;
+        worker = hub_.pop();
+      }
       auto last_hop = tbl_.lookup_direct(hdl);
+      auto& queue = queue_ptr(last_hop);
       if (worker != nullptr) {
         CAF_LOG_DEBUG("launch BASP worker for deserializing a"
                       << hdr.operation);
-        worker->launch(last_hop, hdr, *payload);
+        worker->launch(queue, last_hop, hdr, *payload, deserialization_time);
       } else {
         CAF_LOG_DEBUG("out of BASP workers, continue deserializing a"
                       << hdr.operation);
@@ -430,13 +488,15 @@ connection_state instance::handle(execution_unit* ctx, connection_handle hdl,
         struct handler : remote_message_handler<handler> {
           handler(message_queue* queue, proxy_registry* proxies,
                   actor_system* system, node_id last_hop, basp::header& hdr,
-                  byte_buffer& payload)
+                  byte_buffer& payload,
+                  telemetry::hdr_histogram* deserialization_time)
             : queue_(queue),
               proxies_(proxies),
               system_(system),
               last_hop_(std::move(last_hop)),
               hdr_(hdr),
-              payload_(payload) {
+              payload_(payload),
+              deserialization_time_(deserialization_time) {
             msg_id_ = queue_->new_id();
           }
           message_queue* queue_;
@@ -445,9 +505,11 @@ connection_state instance::handle(execution_unit* ctx, connection_handle hdl,
           node_id last_hop_;
           basp::header& hdr_;
           byte_buffer& payload_;
+          telemetry::hdr_histogram* deserialization_time_;
           uint64_t msg_id_;
         };
-        handler f{&queue_, &proxies(), &system(), last_hop, hdr, *payload};
+        handler f{queue.get(), &proxies(), &system(), last_hop, hdr,
+                  *payload,     deserialization_time};
         f.handle_remote_message(callee_.current_execution_unit());
       }
       break;
@@ -481,13 +543,14 @@ connection_state instance::handle(execution_unit* ctx, connection_handle hdl,
       }
       if (dest_node == this_node_) {
         // Delay this message to make sure we don't skip in-flight messages.
-        auto msg_id = queue_.new_id();
+        auto& queue = this->queue(tbl_.lookup_direct(hdl));
+        auto msg_id = queue.new_id();
         auto ptr = make_mailbox_element(nullptr, make_message_id(), {},
                                         delete_atom_v, source_node,
                                         hdr.source_actor,
                                         std::move(fail_state));
-        queue_.push(callee_.current_execution_unit(), msg_id,
-                    callee_.this_actor(), std::move(ptr));
+        queue.push(callee_.current_execution_unit(), msg_id,
+                   callee_.this_actor(), std::move(ptr));
       } else {
         forward(ctx, dest_node, hdr, *payload);
       }
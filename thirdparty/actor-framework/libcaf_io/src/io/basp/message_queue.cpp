@@ -18,6 +18,7 @@
 
 #include "caf/io/basp/message_queue.hpp"
 
+#include <algorithm>
 #include <iterator>
 
 namespace caf::io::basp {
@@ -55,10 +56,13 @@ void message_queue::push(execution_unit* ctx, uint64_t id,
     CAF_ASSERT(next_undelivered <= next_id);
     return;
   }
-  // Get the insertion point.
-  auto pred = [&](const actor_msg& x) { return x.id >= id; };
-  pending.emplace(std::find_if(first, last, pred),
-                  actor_msg{id, std::move(receiver), std::move(content)});
+  // Get the insertion point. Workers usually finish in roughly ascending
+  // order, so the common case appends to the end of `pending`.
+  auto pred = [](const actor_msg& x, uint64_t y) { return x.id < y; };
+  auto pos = first == last || (last - 1)->id < id
+               ? last
+               : std::lower_bound(first, last, id, pred);
+  pending.emplace(pos, actor_msg{id, std::move(receiver), std::move(content)});
 }
 
 void message_queue::drop(execution_unit* ctx, uint64_t id) {
@@ -0,0 +1,67 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2019 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+
+#include "caf/io/basp/peer_metrics.hpp"
+
+#include "caf/node_id.hpp"
+#include "caf/telemetry/metric_registry.hpp"
+
+namespace caf::io::basp {
+
+peer_metrics peer_metrics::make(telemetry::metric_registry& reg,
+                                const node_id& nid) {
+  auto id = to_string(nid);
+  std::initializer_list<telemetry::label_view> lbl{{"node", id}};
+  auto counter = [&](string_view name, string_view helptext,
+                     string_view unit) {
+    return reg.counter_family("caf.middleman", name, {"node"}, helptext, unit,
+                              true)
+      ->get_or_add(lbl);
+  };
+  auto histogram = [&](string_view name, string_view helptext) {
+    return reg.hdr_histogram_family("caf.middleman", name, {"node"}, helptext,
+                                    "seconds")
+      ->get_or_add(lbl);
+  };
+  peer_metrics result;
+  result.inbound_bytes = counter("inbound-bytes",
+                                 "Number of bytes received from the node.",
+                                 "bytes");
+  result.outbound_bytes = counter("outbound-bytes",
+                                  "Number of bytes sent to the node.", "bytes");
+  result.inbound_messages = counter(
+    "inbound-messages", "Number of actor messages received from the node.",
+    "1");
+  result.outbound_messages = counter(
+    "outbound-messages", "Number of actor messages sent to the node.", "1");
+  result.pending_write_bytes
+    = reg.gauge_family("caf.middleman", "pending-write-bytes", {"node"},
+                       "Number of bytes waiting in the output buffer.",
+                       "bytes")
+        ->get_or_add(lbl);
+  result.serialization_time = histogram(
+    "serialization-time", "Time BASP needs to serialize a message.");
+  result.deserialization_time = histogram(
+    "deserialization-time", "Time BASP needs to deserialize a message.");
+  result.heartbeat_interval = histogram(
+    "heartbeat-interval", "Time between two heartbeats from the node.");
+  return result;
+}
+
+} // namespace caf::io::basp
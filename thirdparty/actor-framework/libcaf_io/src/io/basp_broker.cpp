@@ -132,6 +132,8 @@ behavior basp_broker::make_behavior() {
       CAF_LOG_TRACE(CAF_ARG(msg.handle));
       set_context(msg.handle);
       auto& ctx = *this_context;
+      if (ctx.metrics.enabled())
+        ctx.metrics.inbound_bytes->inc(static_cast<int64_t>(msg.buf.size()));
       auto next = instance.handle(context(), msg, ctx.hdr,
                                   ctx.cstate == basp::await_payload);
       if (requires_shutdown(next)) {
@@ -161,7 +163,8 @@ behavior basp_broker::make_behavior() {
       if (src && system().node() == src->node())
         system().registry().put(src->id(), src);
       if (!instance.dispatch(context(), src, fwd_stack, dest->node(),
-                             dest->id(), 0, mid, msg)
+                             dest->id(), 0, mid, msg,
+                             &current_mailbox_element()->trace)
           && mid.is_request()) {
         detail::sync_request_bouncer srb{exit_reason::remote_link_unreachable};
         srb(src, mid);
@@ -180,8 +183,8 @@ behavior basp_broker::make_behavior() {
       if (system().node() == sender->node())
         system().registry().put(sender->id(), sender);
       if (!instance.dispatch(context(), sender, cme->stages, dest_node, dest_id,
-                             basp::header::named_receiver_flag, cme->mid,
-                             msg)) {
+                             basp::header::named_receiver_flag, cme->mid, msg,
+                             &cme->trace)) {
         detail::sync_request_bouncer srb{exit_reason::remote_link_unreachable};
         srb(sender, cme->mid);
       }
@@ -265,7 +268,7 @@ behavior basp_broker::make_behavior() {
       // sending us a message through the queue. This message gets
       // delivered only after all received messages up to this point were
       // deserialized and delivered.
-      auto& q = instance.queue();
+      auto& q = instance.queue(instance.tbl().lookup_direct(msg.handle));
       auto msg_id = q.new_id();
       q.push(context(), msg_id, ctrl(),
              make_mailbox_element(nullptr, make_message_id(), {}, delete_atom_v,
@@ -458,6 +461,8 @@ void basp_broker::purge_state(const node_id& nid) {
   CAF_LOG_TRACE(CAF_ARG(nid));
   // Destroy all proxies of the lost node.
   namespace_.erase(nid);
+  // Drop the ordering queue for the lost node.
+  instance.erase_queue(nid);
   // Cleanup all remaining references to the lost node.
   for (auto& kvp : monitored_actors)
     kvp.second.erase(nid);
@@ -572,6 +577,10 @@ void basp_broker::learned_new_node(const node_id& nid) {
 void basp_broker::learned_new_node_directly(const node_id& nid,
                                             bool was_indirectly_before) {
   CAF_LOG_TRACE(CAF_ARG(nid));
+  if (auto hdl = instance.tbl().lookup_direct(nid)) {
+    if (auto i = ctx.find(*hdl); i != ctx.end())
+      i->second.metrics = basp::peer_metrics::make(system().metrics(), nid);
+  }
   if (!was_indirectly_before)
     learned_new_node(nid);
 }
@@ -643,15 +652,43 @@ void basp_broker::connection_cleanup(connection_handle hdl, sec code) {
 }
 
 byte_buffer& basp_broker::get_buffer(connection_handle hdl) {
-  return wr_buf(hdl);
+  auto& buf = wr_buf(hdl);
+  // Remember where the new data starts for counting outbound bytes on flush.
+  if (auto i = ctx.find(hdl); i != ctx.end() && i->second.metrics.enabled()
+                              && !i->second.wr_mark)
+    i->second.wr_mark = buf.size();
+  return buf;
 }
 
 void basp_broker::flush(connection_handle hdl) {
+  auto i = ctx.find(hdl);
+  if (i == ctx.end() || !i->second.metrics.enabled()) {
+    super::flush(hdl);
+    return;
+  }
+  auto& ep = i->second;
+  if (ep.wr_mark) {
+    auto size = wr_buf(hdl).size();
+    if (size > *ep.wr_mark)
+      ep.metrics.outbound_bytes->inc(static_cast<int64_t>(size - *ep.wr_mark));
+    ep.wr_mark = none;
+  }
   super::flush(hdl);
+  auto pending = static_cast<int64_t>(wr_buf(hdl).size());
+  ep.metrics.pending_write_bytes->value(pending);
 }
 
 void basp_broker::handle_heartbeat() {
-  // nop
+  if (this_context == nullptr || !this_context->metrics.enabled())
+    return;
+  auto& metrics = this_context->metrics;
+  auto now = std::chrono::steady_clock::now();
+  if (metrics.last_heartbeat != std::chrono::steady_clock::time_point{}) {
+    using fractional_seconds = std::chrono::duration<double>;
+    auto delta = fractional_seconds{now - metrics.last_heartbeat};
+    metrics.heartbeat_interval->observe(delta.count());
+  }
+  metrics.last_heartbeat = now;
 }
 
 execution_unit* basp_broker::current_execution_unit() {
@@ -662,4 +699,11 @@ strong_actor_ptr basp_broker::this_actor() {
   return ctrl();
 }
 
+basp::peer_metrics* basp_broker::metrics(connection_handle hdl) {
+  auto i = ctx.find(hdl);
+  if (i != ctx.end() && i->second.metrics.enabled())
+    return &i->second.metrics;
+  return nullptr;
+}
+
 } // namespace caf::io
@@ -102,7 +102,9 @@ void middleman::add_module_options(actor_system_config& cfg) {
                "schedule utility actors instead of dedicating threads")
     .add<bool>("manual-multiplexing",
                "disables background activity of the multiplexer")
-    .add<size_t>("workers", "number of deserialization workers");
+    .add<size_t>("workers", "number of deserialization workers")
+    .add<size_t>("max-workers",
+                 "upper bound for adding deserialization workers on backlog");
   config_option_adder{cfg.custom_options(), "caf.middleman.prometheus-http"}
     .add<uint16_t>("port", "listening port for incoming scrapes")
     .add<std::string>("address", "bind address for the HTTP server socket");
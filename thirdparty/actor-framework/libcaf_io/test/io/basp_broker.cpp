@@ -538,6 +538,76 @@ CAF_TEST(client_handshake_and_dispatch) {
   jupiter().dummy_actor->receive([](int i) { CAF_CHECK_EQUAL(i, 6); });
 }
 
+CAF_TEST(basp_collects_metrics_per_peer) {
+  connect_node(jupiter());
+  mock(jupiter().connection,
+       {basp::message_type::direct_message, 0, 0, 0,
+        jupiter().dummy_actor->id(), self()->id()},
+       std::vector<strong_actor_ptr>{}, make_message(1, 2, 3))
+    .receive(jupiter().connection, basp::message_type::monitor_message,
+             no_flags, any_vals, no_operation_data, invalid_actor_id,
+             jupiter().dummy_actor->id(), this_node(), jupiter().id);
+  self()->receive([](int, int, int) {});
+  auto& reg = sys.metrics();
+  auto node = to_string(jupiter().id);
+  auto counter = [&](string_view name, string_view unit) {
+    return reg
+      .counter_instance("caf.middleman", name, {{"node", node}}, "", unit, true)
+      ->value();
+  };
+  auto samples = [&](string_view name) {
+    return reg
+      .hdr_histogram_family("caf.middleman", name, {"node"}, "", "seconds")
+      ->get_or_add({{"node", node}})
+      ->count();
+  };
+  CAF_MESSAGE("BASP counts actor messages, i.e., ignores handshakes");
+  CAF_CHECK_EQUAL(counter("inbound-messages", "1"), 1);
+  CAF_CHECK_EQUAL(samples("deserialization-time"), 1);
+  CAF_MESSAGE("BASP queries the spawn server of new nodes");
+  CAF_CHECK_GREATER_OR_EQUAL(counter("outbound-messages", "1"), 1);
+  CAF_CHECK_GREATER_OR_EQUAL(samples("serialization-time"), 1);
+  CAF_MESSAGE("BASP counts bytes on the wire");
+  CAF_CHECK_GREATER(counter("inbound-bytes", "bytes"), 0);
+  CAF_CHECK_GREATER(counter("outbound-bytes", "bytes"), 0);
+}
+
+CAF_TEST(basp_propagates_trace_contexts) {
+  connect_node(jupiter());
+  CAF_MESSAGE("receive a message of a sampled trace from Jupiter");
+  auto trace = trace_context::make_root(trace_context::sampled_flag);
+  mock(jupiter().connection,
+       {basp::message_type::direct_message, basp::header::trace_context_flag,
+        0, 0, jupiter().dummy_actor->id(), self()->id()},
+       trace, std::vector<strong_actor_ptr>{}, make_message(1, 2, 3))
+    .receive(jupiter().connection, basp::message_type::monitor_message,
+             no_flags, any_vals, no_operation_data, invalid_actor_id,
+             jupiter().dummy_actor->id(), this_node(), jupiter().id);
+  self()->receive([&](int a, int b, int c) {
+    CAF_CHECK_EQUAL(self()->current_mailbox_element()->trace, trace);
+    return a + b + c;
+  });
+  CAF_MESSAGE("the response to Jupiter continues the trace");
+  mpx()->exec_runnable();
+  basp::header hdr;
+  byte_buffer buf;
+  std::tie(hdr, buf) = read_from_out_buf(jupiter().connection);
+  CAF_CHECK_EQUAL(hdr.operation, basp::message_type::direct_message);
+  CAF_CHECK(hdr.has(basp::header::trace_context_flag));
+  binary_deserializer source{mpx(), buf};
+  trace_context out_trace;
+  std::vector<strong_actor_ptr> stages;
+  message msg;
+  if (!source.apply_objects(out_trace, stages, msg))
+    CAF_FAIL("deserialization failed: " << source.get_error());
+  CAF_CHECK(out_trace.sampled());
+  CAF_CHECK_EQUAL(out_trace.trace_id_high, trace.trace_id_high);
+  CAF_CHECK_EQUAL(out_trace.trace_id_low, trace.trace_id_low);
+  CAF_CHECK_NOT_EQUAL(out_trace.parent_span_id, 0u);
+  CAF_CHECK_NOT_EQUAL(out_trace.span_id, trace.span_id);
+  CAF_CHECK_EQUAL(msg.get_as<int>(0), 6);
+}
+
 CAF_TEST(message_forwarding) {
   // connect two remote nodes
   connect_node(jupiter());
@@ -76,13 +76,16 @@ private:
 
 struct fixture : test_coordinator_fixture<> {
   detail::worker_hub<io::basp::worker> hub;
-  io::basp::message_queue queue;
+  io::basp::message_queue_ptr queue;
   mock_proxy_registry_backend proxies_backend;
   proxy_registry proxies;
   node_id last_hop;
   actor testee;
 
-  fixture() : proxies_backend(sys), proxies(sys, proxies_backend) {
+  fixture()
+    : queue(std::make_shared<io::basp::message_queue>()),
+      proxies_backend(sys),
+      proxies(sys, proxies_backend) {
     auto tmp = make_node_id(123, "0011223344556677889900112233445566778899");
     last_hop = unbox(std::move(tmp));
     testee = sys.spawn<lazy_init>(testee_impl);
@@ -101,7 +104,7 @@ CAF_TEST_FIXTURE_SCOPE(worker_tests, fixture)
 CAF_TEST(deliver serialized message) {
   CAF_MESSAGE("create the BASP worker");
   CAF_REQUIRE_EQUAL(hub.peek(), nullptr);
-  hub.add_new_worker(queue, proxies);
+  hub.add_new_worker(proxies);
   CAF_REQUIRE_NOT_EQUAL(hub.peek(), nullptr);
   auto w = hub.pop();
   CAF_MESSAGE("create a fake message + BASP header");
@@ -118,7 +121,7 @@ CAF_TEST(deliver serialized message) {
                        42,
                        testee.id()};
   CAF_MESSAGE("launch worker");
-  w->launch(last_hop, hdr, payload);
+  w->launch(queue, last_hop, hdr, payload);
   sched.run_once();
   expect((ok_atom), from(_).to(testee));
 }
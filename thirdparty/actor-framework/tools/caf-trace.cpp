@@ -0,0 +1,48 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "caf/all.hpp"
+#include "caf/trace_profiler.hpp"
+
+using namespace caf;
+
+namespace {
+
+constexpr const char* usage = R"(usage: caf-trace <input> [<output>]
+
+Converts a trace file written by caf::trace_profiler into JSON in the Trace
+Event Format, as read by chrome://tracing and https://ui.perfetto.dev. Prints
+to STDOUT unless <output> is given.
+)";
+
+} // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2 || argc > 3 || argv[1] == std::string{"-h"}
+      || argv[1] == std::string{"--help"}) {
+    std::cerr << usage;
+    return EXIT_FAILURE;
+  }
+  std::ifstream in{argv[1], std::ios::binary};
+  if (!in) {
+    std::cerr << "*** unable to open input file: " << argv[1] << '\n';
+    return EXIT_FAILURE;
+  }
+  std::ofstream out_file;
+  if (argc == 3) {
+    out_file.open(argv[2]);
+    if (!out_file) {
+      std::cerr << "*** unable to open output file: " << argv[2] << '\n';
+      return EXIT_FAILURE;
+    }
+  }
+  auto& out = argc == 3 ? out_file : std::cout;
+  if (auto err = trace_profiler::convert_to_json(in, out)) {
+    std::cerr << "*** unable to convert " << argv[1] << ": " << to_string(err)
+              << '\n';
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
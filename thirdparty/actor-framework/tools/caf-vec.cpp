@@ -1,5 +1,7 @@
+#include <array>
 #include <cassert>
 #include <cctype>
+#include <charconv>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -36,6 +38,44 @@ void trim(string& s) {
   s.erase(find_if(s.rbegin(), s.rend(), not_space).base(), s.end());
 }
 
+// removes leading and trailing whitespaces
+string_view trimmed(string_view s) {
+  auto first = s.find_first_not_of(" \t\r\n");
+  if (first == string_view::npos)
+    return {};
+  auto last = s.find_last_not_of(" \t\r\n");
+  return s.substr(first, last - first + 1);
+}
+
+void assign(string& dst, string_view src) {
+  dst.assign(src.data(), src.size());
+}
+
+// parses an integer that spans the entire input
+template <class T>
+bool parse_int(string_view str, T& x) {
+  auto last = str.data() + str.size();
+  auto res = std::from_chars(str.data(), last, x);
+  return res.ec == std::errc{} && res.ptr == last;
+}
+
+// splits the first `N` space-separated fields of `line` and stores the
+// remainder (without surrounding whitespaces) in `rest`
+template <size_t N>
+bool split_fields(string_view line, std::array<string_view, N>& fields,
+                  string_view& rest) {
+  for (auto& field : fields) {
+    auto first = line.find_first_not_of(' ');
+    if (first == string_view::npos)
+      return false;
+    line.remove_prefix(first);
+    field = line.substr(0, line.find(' '));
+    line.remove_prefix(field.size());
+  }
+  rest = trimmed(line);
+  return true;
+}
+
 // -- convenience functions for I/O streams
 
 using istream_fun = std::function<std::istream&(std::istream&)>;
@@ -118,18 +158,14 @@ std::ostream& operator<<(std::ostream& out, const log_level& lvl) {
   return out << log_level_name[static_cast<size_t>(lvl)];
 }
 
-std::istream& operator>>(std::istream& in, log_level& lvl) {
-  std::string tmp;
-  in >> tmp;
-  auto pred = [&](const char* cstr) { return cstr == tmp; };
+log_level to_log_level(string_view str) {
+  auto pred = [&](const char* cstr) { return str == cstr; };
   auto b = std::begin(log_level_name);
   auto e = std::end(log_level_name);
   auto i = std::find_if(b, e, pred);
   if (i == e)
-    lvl = log_level::invalid;
-  else
-    lvl = static_cast<log_level>(std::distance(b, i));
-  return in;
+    return log_level::invalid;
+  return static_cast<log_level>(std::distance(b, i));
 }
 
 /// The ID of entities as used in a logfile. If the logger field is "actor0"
@@ -145,8 +181,15 @@ bool operator<(const logger_id& x, const logger_id& y) {
   return x.aid == 0 && y.aid == 0 ? x.tid < y.tid : x.aid < y.aid;
 }
 
-std::istream& operator>>(std::istream& in, logger_id& x) {
-  return in >> consume("actor") >> x.aid >> skip_whitespaces >> x.tid;
+// parses the [LOGGER] and [THREAD] fields
+bool parse_logger_id(string_view logger, string_view thread, logger_id& x) {
+  if (!starts_with(logger, "actor"))
+    return false;
+  logger.remove_prefix(5);
+  if (!parse_int(logger, x.aid))
+    return false;
+  assign(x.tid, thread);
+  return true;
 }
 
 std::istream& operator>>(std::istream& in, node_id& x) {
@@ -462,17 +505,53 @@ bool field_key_compare(const std::pair<const std::string, std::string>& x,
   if (!y.fields.empty())                                                       \
     return sec::invalid_argument;
 
+se_type to_se_type(string_view str) {
+  if (str == "SPAWN")
+    return se_type::spawn;
+  if (str == "INIT")
+    return se_type::init;
+  if (str == "SEND")
+    return se_type::send;
+  if (str == "REJECT")
+    return se_type::reject;
+  if (str == "RECEIVE")
+    return se_type::receive;
+  if (str == "DROP")
+    return se_type::drop;
+  if (str == "SKIP")
+    return se_type::skip;
+  if (str == "FINALIZE")
+    return se_type::finalize;
+  if (str == "TERMINATE")
+    return se_type::terminate;
+  return se_type::none;
+}
+
 expected<se_event> parse_event(const enhanced_log_entry& x) {
+  // format is <TYPE> ; <FIELD> = <CONTENT> ; ...
+  string_view msg = x.data.message;
+  auto type = msg.substr(0, msg.find(' '));
+  // most log entries are not events, so we can stop here without parsing
+  // any fields
+  if (to_se_type(type) == se_type::none)
+    return se_event{&x.id, x.vstamp, se_type::none, string_map{}};
   se_event y{&x.id, x.vstamp, se_type::none, string_map{}};
-  std::istringstream in{x.data.message};
-  string type;
-  if (!(in >> type))
-    return sec::invalid_argument;
-  string field_name;
-  string field_content;
-  in >> consume(";");
-  while (in >> field_name >> consume("=") >> rd_line(field_content, ';'))
-    y.fields.emplace(std::move(field_name), std::move(field_content));
+  msg.remove_prefix(type.size());
+  msg = trimmed(msg);
+  if (!starts_with(msg, ";"))
+    msg = string_view{};
+  while (!msg.empty()) {
+    msg.remove_prefix(1);
+    auto field = msg.substr(0, msg.find(';'));
+    msg.remove_prefix(field.size());
+    auto eq = field.find('=');
+    if (eq == string_view::npos)
+      break;
+    auto field_name = trimmed(field.substr(0, eq));
+    auto field_content = trimmed(field.substr(eq + 1));
+    y.fields.emplace(string{field_name.begin(), field_name.end()},
+                     string{field_content.begin(), field_content.end()});
+  }
   if (type == "SPAWN") {
     y.type = se_type::spawn;
     CHECK_FIELDS("ID", "ARGS");
@@ -515,14 +594,33 @@ std::ostream& operator<<(std::ostream& out, const enhanced_log_entry& x) {
              << x.data.line_number << ' ' << x.data.message;
 }
 
-std::istream& operator>>(std::istream& in, log_entry& x) {
-  in >> x.timestamp >> x.component >> x.level >> consume("actor") >> x.id.aid
-    >> x.id.tid >> x.class_name >> x.function_name >> skip_whitespaces
-    >> rd_line(x.file_name, ':') >> x.line_number >> skip_whitespaces
-    >> rd_line(x.message);
-  if (x.level == log_level::invalid)
-    in.setstate(std::ios::failbit);
-  return in;
+// parses a log entry from `line`, re-using the memory of `x`
+bool parse_entry(string_view line, log_entry& x) {
+  // format is <TIMESTAMP> <COMPONENT> <LEVEL> actor<ID> <THREAD> <CLASS>
+  //           <FUNCTION> <FILE>:<LINE> <MESSAGE>
+  std::array<string_view, 8> fields;
+  string_view message;
+  if (!split_fields(line, fields, message))
+    return false;
+  auto sep = fields[7].rfind(':');
+  if (sep == string_view::npos)
+    return false;
+  x.level = to_log_level(fields[2]);
+  if (!parse_int(fields[0], x.timestamp) || x.level == log_level::invalid
+      || !parse_logger_id(fields[3], fields[4], x.id)
+      || !parse_int(fields[7].substr(sep + 1), x.line_number))
+    return false;
+  assign(x.component, fields[1]);
+  assign(x.class_name, fields[5]);
+  assign(x.function_name, fields[6]);
+  assign(x.file_name, fields[7].substr(0, sep));
+  assign(x.message, message);
+  return true;
+}
+
+// reads the next entry from `in`, stopping at the first malformed line
+bool read_entry(std::istream& in, string& line, log_entry& x) {
+  return std::getline(in, line) && parse_entry(line, x);
 }
 
 struct logger_id_meta_data {
@@ -556,16 +654,19 @@ expected<first_pass_result> first_pass(blocking_actor* self, std::istream& in,
   }
   if (vl >= verbosity_level::informative)
     aout(self) << "found node " << res.this_node << std::endl;
-  logger_id id;
-  string message;
-  while (in >> skip_word >> skip_word >> skip_word >> id >> skip_word
-         >> skip_word >> skip_word >> rd_line(message)) {
+  // read line by line into a single buffer, re-using the memory of `line`
+  // and `entry` for all entries
+  string line;
+  log_entry entry;
+  while (read_entry(in, line, entry)) {
     // store in map
-    auto i
-      = res.entities.emplace(id, logger_id_meta_data{false, "actor"}).first;
-    if (starts_with(message, "INIT ; NAME = ")) {
-      std::istringstream iss{message};
-      iss >> consume("INIT ; NAME = ") >> rd_line(i->second.pretty_name, ';');
+    auto i = res.entities.emplace(entry.id, logger_id_meta_data{false, "actor"})
+               .first;
+    string_view message = entry.message;
+    string_view prefix = "INIT ; NAME = ";
+    if (starts_with(message, prefix)) {
+      auto name = message.substr(prefix.size());
+      assign(i->second.pretty_name, trimmed(name.substr(0, name.find(';'))));
       if (ends_with(message, "HIDDEN = true"))
         i->second.hidden = true;
     }
@@ -612,10 +713,22 @@ void second_pass(blocking_actor* self, const group& grp,
     CAF_RAISE_ERROR("logger ID not found");
   };
   // additional state for second pass
-  size_t line = 0;
+  string line;
   log_entry plain_entry;
-  std::vector<se_event> in_flight_messages;
-  std::vector<se_event> in_flight_spawns;
+  // maps the fields of SEND events to their vector timestamp, erasing entries
+  // when receiving them to keep memory usage proportional to the number of
+  // messages in flight rather than to the size of the log
+  std::multimap<string_map, vector_timestamp> in_flight_messages;
+  // maps the ID field of SPAWN events to their vector timestamp
+  std::map<string, se_event> in_flight_spawns;
+  // collects output lines to reduce contention on `out_mtx`
+  static constexpr size_t max_buffered_output = 64 * 1024;
+  std::ostringstream out_buf;
+  auto flush = [&] {
+    std::lock_guard<std::mutex> guard{out_mtx};
+    out << out_buf.str();
+    out_buf.str(string{});
+  };
   // maps scoped actor IDs to their parent ID
   std::map<logger_id, logger_id> scoped_actors;
   // lambda for broadcasting events that could cross node boundary
@@ -627,30 +740,26 @@ void second_pass(blocking_actor* self, const group& grp,
       self->send(grp, x);
   };
   // fetch message from another node via the group
-  auto fetch_message
-    = [&](const std::map<string, string>& fields) -> se_event& {
+  auto fetch_message = [&](const string_map& fields) {
     // TODO: this receive unconditionally waits on a message,
     //       i.e., is a potential deadlock
     if (vl >= verbosity_level::noisy)
       aout(self) << "wait for send from another node matching fields "
                  << deep_to_string(fields) << std::endl;
-    se_event* res = nullptr;
-    self->receive_while([&] { return res == nullptr; })([&](const se_event& x) {
-      switch (x.type) {
-        default:
-          break;
-        case se_type::send:
-          in_flight_messages.emplace_back(x);
-          if (x.fields == fields)
-            res = &in_flight_messages.back();
-          break;
-      }
+    auto res = in_flight_messages.end();
+    auto e = in_flight_messages.end();
+    self->receive_while([&] { return res == e; })([&](const se_event& x) {
+      // skip our own broadcasts
+      if (x.type != se_type::send || x.source->nid == nid)
+        return;
+      auto i = in_flight_messages.emplace(x.fields, x.vstamp);
+      if (x.fields == fields)
+        res = i;
     });
-    return *res;
+    return res;
   };
   // second pass
-  while (in >> plain_entry) {
-    ++line;
+  while (read_entry(in, line, plain_entry)) {
     // increment local time
     auto& st = state(plain_entry.id);
     // do not produce log output for internal actors but still track messages
@@ -669,39 +778,33 @@ void second_pass(blocking_actor* self, const group& grp,
           break;
         case se_type::send:
           bcast(event);
-          in_flight_messages.emplace_back(std::move(event));
+          in_flight_messages.emplace(std::move(event.fields),
+                                     std::move(event.vstamp));
           break;
         case se_type::receive: {
-          auto pred = [&](const se_event& x) {
-            assert(x.type == se_type::send);
-            return event.fields == x.fields;
-          };
-          auto e = in_flight_messages.end();
-          auto i = std::find_if(in_flight_messages.begin(), e, pred);
-          if (i != e) {
-            merge(st.clock, i->vstamp);
-          } else {
-            merge(st.clock, fetch_message(event.fields).vstamp);
-          }
+          // equal keys preserve insertion order, i.e., we match identical
+          // messages in the order they were sent
+          auto i = in_flight_messages.find(event.fields);
+          if (i == in_flight_messages.end())
+            i = fetch_message(event.fields);
+          merge(st.clock, i->second);
+          in_flight_messages.erase(i);
           break;
         }
-        case se_type::spawn:
-          in_flight_spawns.emplace_back(std::move(event));
+        case se_type::spawn: {
+          auto id_field = get(event.fields, "ID");
+          in_flight_spawns.emplace(std::move(id_field), std::move(event));
           break;
+        }
         case se_type::init: {
-          auto id_field = std::to_string(st.eid.aid);
-          auto pred = [&](const se_event& x) {
-            assert(x.type == se_type::spawn);
-            return get(x.fields, "ID") == id_field;
-          };
-          auto e = in_flight_spawns.end();
-          auto i = std::find_if(in_flight_spawns.begin(), e, pred);
-          if (i != e) {
-            merge(st.clock, i->vstamp);
+          auto i = in_flight_spawns.find(std::to_string(st.eid.aid));
+          if (i != in_flight_spawns.end()) {
+            merge(st.clock, i->second.vstamp);
             // keep book on scoped actors since their terminate
             // event propagates back to the parent
             if (get(event.fields, "NAME") == "scoped_actor")
-              scoped_actors.emplace(plain_entry.id, to_logger_id(*i->source));
+              scoped_actors.emplace(plain_entry.id,
+                                    to_logger_id(*i->second.source));
             in_flight_spawns.erase(i);
           } else {
             std::cerr << "*** cannot match init event to a previous spawn"
@@ -720,28 +823,28 @@ void second_pass(blocking_actor* self, const group& grp,
           break;
       }
     }
+    // print entry to output file
+    if (internal)
+      continue;
     // create ShiViz compatible JSON-formatted vector timestamp
-    std::ostringstream oss;
-    oss << '{';
-    bool need_comma = false;
+    auto& json = entry.json_vstamp;
+    json += '{';
     for (size_t i = 0; i < st.clock.size(); ++i) {
-      auto x = st.clock[i];
-      if (x > 0) {
-        if (need_comma)
-          oss << ',';
-        else
-          need_comma = true;
-        oss << '"' << json_names[i] << '"' << ':' << x;
+      if (auto x = st.clock[i]; x > 0) {
+        if (json.size() > 1)
+          json += ',';
+        json += '"';
+        json += json_names[i];
+        json += "\":";
+        json += std::to_string(x);
       }
     }
-    oss << '}';
-    entry.json_vstamp = oss.str();
-    // print entry to output file
-    if (!internal) {
-      std::lock_guard<std::mutex> guard{out_mtx};
-      out << entry << '\n';
-    }
+    json += '}';
+    out_buf << entry << '\n';
+    if (static_cast<size_t>(out_buf.tellp()) >= max_buffered_output)
+      flush();
   }
+  flush();
 }
 
 namespace {